@@ -0,0 +1,88 @@
+#ifndef ARENA_H
+#define ARENA_H
+
+#include <stddef.h>
+
+/**
+ * @file arena.h
+ * @brief Arena (region) allocator utilities and definitions.
+ *
+ * This header file contains function declarations and macro definitions for
+ * the arena source file. An arena hands out memory by bumping a pointer
+ * through large blocks; individual allocations are never freed; instead the
+ * whole arena is reset or destroyed at once.
+ */
+
+/**
+ * @brief Default capacity, in bytes, of each arena block.
+ */
+#define ARENA_DEFAULT_BLOCK_SIZE (1024 * 1024)
+
+/**
+ * @brief Alignment, in bytes, of every pointer returned by `arena_alloc`.
+ */
+#define ARENA_ALIGNMENT 16
+
+/**
+ * @brief A single block of arena memory (opaque).
+ */
+typedef struct ArenaBlock ArenaBlock;
+
+/**
+ * @brief Structure to represent an arena allocator.
+ *
+ * The arena keeps a chain of blocks. Blocks are kept across resets and
+ * reused in order, so a reset arena allocates no new memory until it grows
+ * past its previous high-water mark.
+ */
+typedef struct Arena
+{
+    ArenaBlock *head;       /**< First block of the chain. */
+    ArenaBlock *current;    /**< Block currently being allocated from. */
+    size_t      block_size; /**< Capacity of newly created blocks. */
+} Arena;
+
+/**
+ * @brief Initializes an empty arena.
+ *
+ * @param block_size Capacity of each block in bytes, or 0 to use
+ *                   `ARENA_DEFAULT_BLOCK_SIZE`.
+ * @return Pointer to the newly created arena, or NULL on failure.
+ */
+Arena *arena_initialization(size_t block_size);
+
+/**
+ * @brief Destroys the arena, freeing every block it owns.
+ *
+ * Every pointer handed out by the arena becomes invalid.
+ *
+ * @param arena Pointer to the arena to be destroyed.
+ */
+void arena_destroy(Arena *arena);
+
+/**
+ * @brief Allocates memory from the arena.
+ *
+ * The returned memory is aligned to `ARENA_ALIGNMENT` and is not
+ * initialized. It stays valid until the arena is reset or destroyed.
+ *
+ * @param arena Pointer to the arena.
+ * @param size  Number of bytes to allocate.
+ * @return Pointer to the allocated memory, or NULL on failure.
+ */
+void *arena_alloc(Arena *arena, size_t size);
+
+/**
+ * @brief Releases every allocation made from the arena in O(1).
+ *
+ * The blocks themselves are kept for reuse by later allocations.
+ *
+ * @param arena Pointer to the arena to be reset.
+ * @return ERROR_SUCCESS on success, or an appropriate error code on failure.
+ *
+ * @warning Every pointer handed out by the arena, including any Array or
+ * Table created from it, becomes invalid.
+ */
+int arena_reset(Arena *arena);
+
+#endif // ARENA_H
@@ -1,6 +1,10 @@
 #ifndef ARRAY_H
 #define ARRAY_H
 
+#include "arena.h"
+
+#include <stddef.h>
+
 /**
  * @file array.h
  * @brief Array utilities and definitions.
@@ -24,38 +28,183 @@ typedef enum
     TYPE_DOUBLE,  /**< Double type */
     TYPE_CHAR,    /**< Character type */
     TYPE_INT_PTR, /**< Pointer type */
+    TYPE_CUSTOM,  /**< Fixed-size element of caller-defined layout */
 } ElementType;
 
+/**
+ * @brief Bytes of element storage held inline in every Array.
+ *
+ * Arrays whose contents fit in this many bytes (e.g. 8 ints) never allocate
+ * an element buffer.
+ */
+#define ARRAY_INLINE_BYTES 32
+
 /**
  * @brief Structure to represent an array with dynamic size.
  *
- * The array is capable of holding any data type, with the actual data stored as
- * void pointers.
+ * Elements are stored unboxed in a single contiguous buffer of
+ * `ele_size * max` bytes, so element `idx` lives at byte offset
+ * `idx * ele_size` from `data`. Small arrays keep their elements in
+ * `inline_buf` and only move to a separate buffer once they outgrow it.
+ *
+ * @warning While `data` points at `inline_buf`, the structure must not be
+ * copied by value; use `array_copy` instead.
  */
 typedef struct
 {
-    void **list; /**< Pointer to the array of elements.*/
-    int    idx;  /**< Current index (number of elements stored in the array). */
-    int    max;  /**< Maximum capacity of the array. */
+    void  *data;     /**< Contiguous buffer holding the elements. */
+    int    idx;      /**< Current index (number of elements stored). */
+    int    max;      /**< Maximum capacity of the array, in elements. */
+    size_t ele_size; /**< Size of a single element in bytes. */
     ElementType ele_type; /**< The type of the elements stored in the array. */
+    Arena *arena; /**< Arena owning the array, or NULL if heap allocated. */
+    union
+    {
+        unsigned char bytes[ARRAY_INLINE_BYTES]; /**< Inline storage. */
+        long long     align_ll;                  /**< Forces alignment. */
+        double        align_d;                   /**< Forces alignment. */
+        void         *align_p;                   /**< Forces alignment. */
+    } inline_buf; /**< Element storage used until the array outgrows it. */
 } Array;
 
+/**
+ * @brief Non-owning, read-only view over a run of elements.
+ *
+ * A view describes `len` elements spaced `stride` bytes apart starting at
+ * `data`, optionally with one of them (`skip`) hidden. Views never allocate
+ * or copy; they stay valid only as long as the memory they point into.
+ */
+typedef struct
+{
+    const char *data;   /**< Address of the first underlying element. */
+    int         len;    /**< Number of underlying elements spanned. */
+    ptrdiff_t   stride; /**< Distance in bytes between consecutive elements. */
+    int         skip;   /**< Underlying index hidden from the view, or -1. */
+} ArrayView;
+
+/**
+ * @brief Comparison function used to order array elements.
+ *
+ * Follows the `qsort` convention: returns a negative value if `lhs` orders
+ * before `rhs`, zero if they are equivalent and a positive value otherwise.
+ */
+typedef int (*ArrayCompare)(const void *lhs, const void *rhs);
+
+/**
+ * @brief Comparison function that also receives caller-supplied context.
+ *
+ * Same convention as `ArrayCompare`; `ctx` is passed through unchanged from
+ * the sort call, e.g. a lookup table the ordering depends on.
+ */
+typedef int (*ArrayCompareCtx)(const void *lhs, const void *rhs, void *ctx);
+
+/**
+ * @brief Accesses an element of an array as the given type.
+ *
+ * No bounds or type checking is performed; this is intended for hot loops
+ * where the caller already knows the element type and the valid range.
+ *
+ * @param array Pointer to the array.
+ * @param type  C type of the stored elements (e.g. `int`).
+ * @param index Index of the element.
+ */
+#define ARRAY_AT(array, type, index) (((type *)(array)->data)[(index)])
+
+/**
+ * @brief Number of elements visible through a view.
+ *
+ * @param view The view (evaluated more than once).
+ */
+#define ARRAY_VIEW_SIZE(view) ((view).len - (0 <= (view).skip))
+
+/**
+ * @brief Maps the index of a visible element to its underlying index.
+ *
+ * @param view  The view (evaluated more than once).
+ * @param index Index of the visible element (evaluated more than once).
+ */
+#define ARRAY_VIEW_INDEX(view, index) \
+    ((index) + ((0 <= (view).skip) && ((index) >= (view).skip)))
+
+/**
+ * @brief Accesses an element of a view as the given type.
+ *
+ * Indices run over the visible elements only, so with `skip == 2` index 2
+ * refers to the fourth underlying element. No bounds checking is performed.
+ *
+ * @param view  The view (evaluated more than once).
+ * @param type  C type of the viewed elements (e.g. `int`).
+ * @param index Index of the visible element (evaluated more than once).
+ */
+#define ARRAY_VIEW_AT(view, type, index) \
+    (*(const type *)((view).data         \
+                     + ARRAY_VIEW_INDEX(view, index) * (view).stride))
+
 /**
  * @brief Initializes an empty array.
  *
  * This function allocates memory for the array and sets up the initial
- * capacity. The elements are initialized to NULL to indicate empty slots.
+ * capacity. The element size is derived from `ele_type`; use
+ * `array_initialization_custom` for `TYPE_CUSTOM` elements.
  *
  * @param ele_type The type of elements stored in the array.
  * @return Pointer to the newly created array, or NULL on failure.
  */
 Array *array_initialization(ElementType ele_type);
 
+/**
+ * @brief Initializes an array structure provided by the caller.
+ *
+ * This sets up an array in caller-owned storage (typically a local
+ * variable), so short arrays that fit in `ARRAY_INLINE_BYTES` need no heap
+ * allocation at all. Release it with `array_release`, not `array_destroy`.
+ *
+ * @param array    Pointer to the array structure to set up.
+ * @param ele_type The type of elements stored in the array.
+ * @return ERROR_SUCCESS on success, or an appropriate error code on failure.
+ */
+int array_init(Array *array, ElementType ele_type);
+
+/**
+ * @brief Releases the element buffer of an array set up with `array_init`.
+ *
+ * The array is left empty and may be reused after another `array_init`.
+ *
+ * @param array Pointer to the array to be released.
+ */
+void array_release(Array *array);
+
+/**
+ * @brief Initializes an empty array inside an arena.
+ *
+ * Both the array structure and its element buffer are carved out of
+ * `arena`. Growing the array copies into a new arena allocation; the old
+ * buffer is reclaimed when the arena is reset or destroyed. `array_destroy`
+ * is a no-op for such arrays.
+ *
+ * @param ele_type The type of elements stored in the array.
+ * @param arena    Pointer to the arena that owns the array.
+ * @return Pointer to the newly created array, or NULL on failure.
+ */
+Array *array_initialization_arena(ElementType ele_type, Arena *arena);
+
+/**
+ * @brief Initializes an empty array of fixed-size custom elements.
+ *
+ * The array stores elements of `ele_size` bytes each (e.g. a coordinate
+ * struct) and has the element type `TYPE_CUSTOM`.
+ *
+ * @param ele_size Size of a single element in bytes.
+ * @return Pointer to the newly created array, or NULL on failure.
+ */
+Array *array_initialization_custom(size_t ele_size);
+
 /**
  * @brief Destroys the array, freeing allocated memory.
  *
- * This function frees the memory for both the array and its elements.
- * Each element is assumed to have been dynamically allocated and will be freed.
+ * This function frees the element buffer and the array structure. Arrays
+ * created from an arena are left untouched; they are released together with
+ * the arena.
  *
  * @param array Pointer to the array to be destroyed.
  */
@@ -64,8 +213,8 @@ void array_destroy(Array *array);
 /**
  * @brief Adds an element to the array.
  *
- * This function adds an element to the array. If the array is full, it is
- * resized.
+ * This function copies `ele_size` bytes from `ele` to the end of the array.
+ * If the array is full, it is resized.
  *
  * @param array    Pointer to the array where the element is added.
  * @param ele      The element to be added.
@@ -73,12 +222,47 @@ void array_destroy(Array *array);
  */
 int array_add(Array *array, const void *ele);
 
+/**
+ * @brief Adds several elements to the array in one copy.
+ *
+ * This function appends `count` contiguous elements read from `eles`. The
+ * array is grown at most once, to fit all of the new elements.
+ *
+ * @param array Pointer to the array where the elements are added.
+ * @param eles  Pointer to `count * ele_size` bytes of element data.
+ * @param count Number of elements to add.
+ * @return ERROR_SUCCESS on success, or an appropriate error code on failure.
+ */
+int array_add_n(Array *array, const void *eles, int count);
+
+/**
+ * @brief Ensures the array can hold at least `capacity` elements.
+ *
+ * This function grows the element buffer so that the next
+ * `capacity - array->idx` additions do not reallocate. The array is never
+ * shrunk.
+ *
+ * @param array    Pointer to the array.
+ * @param capacity Minimum number of elements the array must be able to hold.
+ * @return ERROR_SUCCESS on success, or an appropriate error code on failure.
+ */
+int array_reserve(Array *array, int capacity);
+
+/**
+ * @brief Returns a pointer to the element at the given index.
+ *
+ * @param array Pointer to the array.
+ * @param index Index of the element.
+ * @return Pointer to the element, or NULL if the input is invalid or the
+ * index is out of bounds.
+ */
+void *array_get(const Array *array, int index);
+
 /**
  * @brief Resets all elements in the array.
  *
- * This function resets all elements in the array by freeing any allocated
- * memory for each element and setting the pointers to `NULL`. The array itself
- * remains allocated with its current capacity.
+ * This function empties the array by setting its element count to zero.
+ * The element buffer remains allocated with its current capacity.
  *
  * @param array Pointer to the array to be reset.
  * @return ERROR_SUCCESS on success, or an appropriate error code on failure.
@@ -93,7 +277,7 @@ int array_reset(Array *array);
  *
  * This function copies all elements from the source array (`src`) to the
  * destination array (`dst`). The destination array is reset before the copy
- * begins. The elements are copied one by one using the `array_add` function.
+ * begins and grown if needed; the elements are copied in a single `memcpy`.
  *
  * @param src Pointer to the source array to be copied from.
  * @param dst Pointer to the destination array to be copied to.
@@ -102,6 +286,179 @@ int array_reset(Array *array);
  */
 int array_copy(Array *src, Array *dst);
 
+/**
+ * @brief Exchanges the contents of two arrays in O(1).
+ *
+ * Element buffers change owners instead of being copied; only arrays still
+ * using their inline buffer have those bytes exchanged.
+ *
+ * @param a Pointer to the first array.
+ * @param b Pointer to the second array.
+ * @return ERROR_SUCCESS on success, or an appropriate error code on failure.
+ *
+ * @warning Both arrays must be owned by the same arena, or both by the heap.
+ */
+int array_swap(Array *a, Array *b);
+
+/**
+ * @brief Moves the contents of one array into another in O(1).
+ *
+ * The destination's previous buffer is released and it takes over the
+ * source's buffer. The source is left empty but usable.
+ *
+ * @param dst Pointer to the array that receives the contents.
+ * @param src Pointer to the array whose contents are moved.
+ * @return ERROR_SUCCESS on success, or an appropriate error code on failure.
+ *
+ * @warning Both arrays must be owned by the same arena, or both by the heap.
+ */
+int array_move(Array *dst, Array *src);
+
+/**
+ * @brief Creates a view over every element of an array.
+ *
+ * @param array Pointer to the array to be viewed.
+ * @return A view of the array, or an empty view if `array` is NULL.
+ *
+ * @warning The view is invalidated if the array grows or is destroyed.
+ */
+ArrayView array_view(const Array *array);
+
+/**
+ * @brief Creates a view over a raw buffer of fixed-size elements.
+ *
+ * @param data     Pointer to the first element.
+ * @param len      Number of elements.
+ * @param ele_size Size of a single element in bytes.
+ * @return A view of the buffer, or an empty view on invalid input.
+ */
+ArrayView array_view_buffer(const void *data, int len, size_t ele_size);
+
+/**
+ * @brief Narrows a view to a sub-range of its underlying elements.
+ *
+ * The range is clamped to the view. A hidden element inside the range stays
+ * hidden; one outside it is dropped.
+ *
+ * @param view  The view to narrow.
+ * @param start Underlying index of the first element of the slice.
+ * @param len   Number of underlying elements in the slice.
+ * @return The narrowed view.
+ */
+ArrayView array_view_slice(ArrayView view, int start, int len);
+
+/**
+ * @brief Hides one element of a view.
+ *
+ * Any element previously hidden by the view becomes visible again.
+ *
+ * @param view  The view to modify.
+ * @param index Underlying index of the element to hide, or -1 for none.
+ * @return The view with `index` hidden.
+ */
+ArrayView array_view_without(ArrayView view, int index);
+
+/**
+ * @brief Sorts the elements of an array in place.
+ *
+ * When `compare` is NULL and the array holds `TYPE_INT` elements, an LSD
+ * radix sort orders the integers ascending in linear time. Otherwise the
+ * elements are ordered by `compare` using `qsort`, which is not stable.
+ *
+ * @param array   Pointer to the array to be sorted.
+ * @param compare Comparison function, or NULL for ascending `TYPE_INT`.
+ * @return ERROR_SUCCESS on success, or an appropriate error code on failure.
+ */
+int array_sort(Array *array, ArrayCompare compare);
+
+/**
+ * @brief Sorts the elements of an array in place, keeping equal elements in
+ * their original order.
+ *
+ * Uses the radix sort for `TYPE_INT` elements when `compare` is NULL, and a
+ * merge sort driven by `compare` otherwise.
+ *
+ * @param array   Pointer to the array to be sorted.
+ * @param compare Comparison function, or NULL for ascending `TYPE_INT`.
+ * @return ERROR_SUCCESS on success, or an appropriate error code on failure.
+ */
+int array_sort_stable(Array *array, ArrayCompare compare);
+
+/**
+ * @brief Stably sorts the elements of an array with a context comparator.
+ *
+ * Like `array_sort_stable` with a comparator, but `ctx` is handed to every
+ * call of `compare`. Short arrays are sorted without allocating.
+ *
+ * @param array   Pointer to the array to be sorted.
+ * @param compare Comparison function.
+ * @param ctx     Context passed to `compare`.
+ * @return ERROR_SUCCESS on success, or an appropriate error code on failure.
+ */
+int array_sort_stable_ctx(Array *array, ArrayCompareCtx compare, void *ctx);
+
+/**
+ * @brief Computes the stable sorting permutation of an integer array.
+ *
+ * Fills `indices` with the positions `0 .. keys->idx - 1` ordered so that
+ * `keys[indices[0]] <= keys[indices[1]] <= ...`; positions of equal keys
+ * stay in ascending order. `keys` itself is not modified.
+ *
+ * @param keys    Pointer to the `TYPE_INT` array providing the sort keys.
+ * @param indices Pointer to the `TYPE_INT` array receiving the permutation.
+ * @return ERROR_SUCCESS on success, or an appropriate error code on failure.
+ */
+int array_argsort(const Array *keys, Array *indices);
+
+/**
+ * @brief Finds the first element not ordered before a key.
+ *
+ * The array must be sorted in the order defined by `compare`. Searches
+ * over `TYPE_INT` with a NULL `compare` use a branchless loop.
+ *
+ * @param array   Pointer to the sorted array.
+ * @param key     Pointer to the key to search for.
+ * @param compare Comparison function, or NULL for ascending `TYPE_INT`.
+ * @return Index of the first element `>= key` (`array->idx` if there is
+ * none), or a negative error code on failure.
+ */
+int array_lower_bound(const Array *array,
+                      const void  *key,
+                      ArrayCompare compare);
+
+/**
+ * @brief Finds the first element ordered after a key.
+ *
+ * The array must be sorted in the order defined by `compare`. Searches
+ * over `TYPE_INT` with a NULL `compare` use a branchless loop.
+ *
+ * @param array   Pointer to the sorted array.
+ * @param key     Pointer to the key to search for.
+ * @param compare Comparison function, or NULL for ascending `TYPE_INT`.
+ * @return Index of the first element `> key` (`array->idx` if there is
+ * none), or a negative error code on failure.
+ */
+int array_upper_bound(const Array *array,
+                      const void  *key,
+                      ArrayCompare compare);
+
+/**
+ * @brief Finds the run of elements equivalent to a key.
+ *
+ * On success `range[0]` is the lower bound and `range[1]` the upper bound
+ * of `key`, so the key occurs `range[1] - range[0]` times.
+ *
+ * @param array   Pointer to the sorted array.
+ * @param key     Pointer to the key to search for.
+ * @param compare Comparison function, or NULL for ascending `TYPE_INT`.
+ * @param range   Output for the half-open index range `[start, end)`.
+ * @return ERROR_SUCCESS on success, or an appropriate error code on failure.
+ */
+int array_equal_range(const Array *array,
+                      const void  *key,
+                      ArrayCompare compare,
+                      int          range[2]);
+
 /**
  * @brief Prints the contents of an array.
  *
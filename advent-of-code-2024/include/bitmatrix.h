@@ -0,0 +1,119 @@
+#ifndef BITMATRIX_H
+#define BITMATRIX_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @file bitmatrix.h
+ * @brief Bit matrix utilities and definitions.
+ *
+ * This header file contains function declarations and macro definitions for
+ * the bit matrix source file. A bit matrix stores one bit per (row, column)
+ * pair, which makes it a compact adjacency matrix for relations over small
+ * dense ids: "is X related to Y" is a single bit test.
+ */
+
+/**
+ * @brief Number of bits held by one word of a bit matrix.
+ */
+#define BITMATRIX_WORD_BITS 64
+
+/**
+ * @brief Structure to represent a matrix of bits.
+ *
+ * Each row occupies `words_per_row` consecutive 64-bit words; bit `col` of
+ * a row lives in word `col / 64` at bit position `col % 64`.
+ */
+typedef struct
+{
+    uint64_t *words;         /**< Row-major bit storage. */
+    int       num_rows;      /**< Number of rows. */
+    int       num_cols;      /**< Number of columns. */
+    int       words_per_row; /**< Words of storage per row. */
+    size_t    capacity;      /**< Words of storage allocated. */
+} BitMatrix;
+
+/**
+ * @brief Tests a bit of the matrix, without bounds checks.
+ *
+ * @param matrix Pointer to the bit matrix.
+ * @param row    Row index.
+ * @param col    Column index.
+ */
+#define BITMATRIX_TEST(matrix, row, col)                            \
+    (0 != (((matrix)->words[(size_t)(row) * (matrix)->words_per_row \
+                            + (col) / BITMATRIX_WORD_BITS]          \
+            >> ((col) % BITMATRIX_WORD_BITS))                       \
+           & 1))
+
+/**
+ * @brief Initializes a bit matrix with every bit cleared.
+ *
+ * @param num_rows Number of rows.
+ * @param num_cols Number of columns.
+ * @return Pointer to the newly created bit matrix, or NULL on failure.
+ */
+BitMatrix *bitmatrix_initialization(int num_rows, int num_cols);
+
+/**
+ * @brief Destroys the bit matrix, freeing allocated memory.
+ *
+ * @param matrix Pointer to the bit matrix to be destroyed.
+ */
+void bitmatrix_destroy(BitMatrix *matrix);
+
+/**
+ * @brief Sets a bit of the matrix.
+ *
+ * @param matrix Pointer to the bit matrix.
+ * @param row    Row index.
+ * @param col    Column index.
+ * @return ERROR_SUCCESS on success, or an appropriate error code on failure.
+ */
+int bitmatrix_set(BitMatrix *matrix, int row, int col);
+
+/**
+ * @brief Clears a bit of the matrix.
+ *
+ * @param matrix Pointer to the bit matrix.
+ * @param row    Row index.
+ * @param col    Column index.
+ * @return ERROR_SUCCESS on success, or an appropriate error code on failure.
+ */
+int bitmatrix_clear(BitMatrix *matrix, int row, int col);
+
+/**
+ * @brief Tests a bit of the matrix.
+ *
+ * @param matrix Pointer to the bit matrix.
+ * @param row    Row index.
+ * @param col    Column index.
+ * @return `true` if the bit is set, `false` if it is clear or the input is
+ * invalid.
+ */
+bool bitmatrix_test(const BitMatrix *matrix, int row, int col);
+
+/**
+ * @brief Clears every bit of the matrix.
+ *
+ * @param matrix Pointer to the bit matrix.
+ */
+void bitmatrix_reset(BitMatrix *matrix);
+
+/**
+ * @brief Changes the dimensions of the matrix and clears every bit.
+ *
+ * The storage is only reallocated when it is too small for the new size,
+ * so a matrix reused for smaller sizes never allocates. On failure the
+ * matrix is left unchanged.
+ *
+ * @param matrix   Pointer to the bit matrix.
+ * @param num_rows New number of rows.
+ * @param num_cols New number of columns.
+ * @return ERROR_SUCCESS on success, or an appropriate error code on failure.
+ */
+int bitmatrix_resize(BitMatrix *matrix, int num_rows, int num_cols);
+
+#endif // BITMATRIX_H
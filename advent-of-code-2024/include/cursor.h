@@ -0,0 +1,118 @@
+#ifndef CURSOR_H
+#define CURSOR_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+/**
+ * @file cursor.h
+ * @brief Zero-copy text cursor utilities and definitions.
+ *
+ * This header file contains function declarations and macro definitions for
+ * the cursor source file. A cursor walks a byte buffer and hands out lines,
+ * delimited fields and integers as spans that point back into the buffer.
+ * Nothing is copied, the buffer is never written to and no NUL terminator
+ * is needed, so a cursor can run directly over a memory-mapped input or
+ * over a single line taken from one.
+ */
+
+/**
+ * @brief A run of characters inside a larger buffer.
+ */
+typedef struct
+{
+    const char *data; /**< First character of the run. */
+    size_t      len;  /**< Number of characters in the run. */
+} Span;
+
+/**
+ * @brief Read position within a buffer.
+ */
+typedef struct
+{
+    const char *pos; /**< Next unread character. */
+    const char *end; /**< One past the last character of the buffer. */
+} Cursor;
+
+/**
+ * @brief Creates a cursor at the start of a buffer.
+ *
+ * @param data Pointer to the buffer.
+ * @param len  Number of characters in the buffer.
+ * @return The cursor.
+ */
+Cursor cursor_initialization(const char *data, size_t len);
+
+/**
+ * @brief Creates a cursor over the characters of a span.
+ *
+ * @param span Span to walk.
+ * @return The cursor.
+ */
+Cursor cursor_from_span(Span span);
+
+/**
+ * @brief Checks whether every character of a cursor has been consumed.
+ *
+ * @param cursor Pointer to the cursor.
+ * @return `true` if nothing is left to read, `false` otherwise.
+ */
+bool cursor_at_end(const Cursor *cursor);
+
+/**
+ * @brief Skips spaces, tabs, carriage returns and newlines.
+ *
+ * @param cursor Pointer to the cursor.
+ */
+void cursor_skip_whitespace(Cursor *cursor);
+
+/**
+ * @brief Reads the next line.
+ *
+ * The line ending ("\n" or "\r\n") is consumed but not part of the line. A
+ * final line without a line ending is still returned.
+ *
+ * @param cursor Pointer to the cursor.
+ * @param line   Output for the line.
+ * @return `true` if a line was read, `false` at the end of the buffer.
+ */
+bool cursor_next_line(Cursor *cursor, Span *line);
+
+/**
+ * @brief Reads the next field up to a delimiter.
+ *
+ * The delimiter is consumed but not part of the field; the last field runs
+ * to the end of the buffer. Empty fields between adjacent delimiters are
+ * returned as empty spans.
+ *
+ * @param cursor    Pointer to the cursor.
+ * @param delimiter Character separating fields.
+ * @param field     Output for the field.
+ * @return `true` if a field was read, `false` at the end of the buffer.
+ */
+bool cursor_next_field(Cursor *cursor, char delimiter, Span *field);
+
+/**
+ * @brief Reads the next integer, skipping any whitespace before it.
+ *
+ * An optional sign is accepted. On failure only the leading whitespace is
+ * consumed.
+ *
+ * @param cursor Pointer to the cursor.
+ * @param value  Output for the integer.
+ * @return `true` if an integer in range of `int` was read, `false`
+ * otherwise.
+ */
+bool cursor_next_int(Cursor *cursor, int *value);
+
+/**
+ * @brief Consumes a literal if the cursor is positioned at it.
+ *
+ * @param cursor  Pointer to the cursor.
+ * @param literal NUL-terminated text to match.
+ * @return `true` if the literal matched and was consumed, `false`
+ * otherwise, in which case the cursor does not move.
+ */
+bool cursor_match(Cursor *cursor, const char *literal);
+
+#endif // CURSOR_H
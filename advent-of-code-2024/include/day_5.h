@@ -10,6 +10,10 @@
  * you add up the middle page number from those correctly-ordered updates?
  *
  * Part Two:
+ * For each of the incorrectly-ordered updates, use the page ordering rules to
+ * put the page numbers in the right order. Find the updates which are not in
+ * the correct order. What do you get if you add up the middle page numbers
+ * after correctly ordering just those updates?
  */
 
 /**
@@ -20,6 +20,7 @@
 #define ERROR_NULL_POINTER        -4 /**< Null pointer dereferenced */
 #define ERROR_INDEX_OUT_OF_BOUNDS -5 /**< Index is out of valid range */
 #define ERROR_ELEMENT_NOT_FOUND   -6 /**< Element does not exist */
+#define ERROR_OUT_OF_RANGE        -7 /**< Value does not fit its type */
 
 /* File Handling Errors */
 #define ERROR_FILE_NOT_FOUND -100 /**< File not found */
@@ -30,4 +31,7 @@
 #define ERROR_CONNECTION_FAIL -200 /**< Network connection failed */
 #define ERROR_TIMEOUT         -201 /**< Operation timed out */
 
+/* Graph Errors */
+#define ERROR_CYCLE_DETECTED -300 /**< Graph contains a cycle */
+
 #endif // ERROR_H
@@ -1,63 +1,314 @@
 #ifndef GRAPH_H
 #define GRAPH_H
 
+#include "array.h"
+#include "bitmatrix.h"
+#include "vector.h"
+
+#include <limits.h>
+#include <stdbool.h>
+
 /**
  * @file graph.h
  * @brief Graph utilities and definitions.
  *
  * This header file contains function declarations and macro definitions for
- * the graph source file.
+ * the graph source file. A graph is built in two phases: edges are first
+ * accumulated in an edge list, then `graph_freeze` packs them into
+ * compressed sparse row (CSR) form, where the successors of every node sit
+ * next to each other in one array. Queries and algorithms require a frozen
+ * graph.
+ *
+ * The traversal algorithms (BFS, Dijkstra and A*) run over a `GraphSource`,
+ * which is either a frozen graph or an implicit graph whose edges come from
+ * a callback, such as the cells of a grid. Their working memory lives in a
+ * `GraphSearch` that is reused from one search to the next.
+ */
+
+/**
+ * @brief Distance of a node that the search has not reached.
+ */
+#define GRAPH_UNREACHABLE LLONG_MAX
+
+/**
+ * @brief Most edges an implicit graph's callback may report for one node.
+ */
+#define GRAPH_MAX_IMPLICIT_DEGREE 8
+
+/**
+ * @brief Node id of a grid cell in an implicit grid graph.
+ *
+ * @param width Number of columns of the grid.
+ * @param row   Row of the cell.
+ * @param col   Column of the cell.
  */
+#define GRAPH_GRID_NODE(width, row, col) ((row) * (width) + (col))
 
 /**
- * @enum ElementType
- * @brief Defines the supported types for elements stored in the graph.
+ * @brief Structure to represent a directed graph over dense integer ids.
  *
- * This enum is used to identify the type of the elements that are stored in
- * the grraph node.
+ * Nodes are the integers `0 .. num_nodes - 1`, where `num_nodes` is one more
+ * than the largest id named by any edge. After freezing, the successors of
+ * node `n` are `targets[offsets[n] .. offsets[n + 1] - 1]`, in the order
+ * their edges were added.
  */
-typedef enum
+typedef struct
 {
-    TYPE_INT,     /**< Integer type */
-    TYPE_FLOAT,   /**< Float type */
-    TYPE_DOUBLE,  /**< Double type */
-    TYPE_CHAR,    /**< Character type */
-    TYPE_INT_PTR, /**< Pointer type */
-} ElementType;
+    IntArray edge_from;   /**< Source of every added edge. */
+    IntArray edge_to;     /**< Destination of every added edge. */
+    IntArray edge_weight; /**< Weight of every added edge. */
+    int     *offsets;     /**< CSR row offsets, `num_nodes + 1` entries. */
+    int     *targets;     /**< CSR successor lists, `num_edges` entries. */
+    int     *weights;     /**< Weight of each entry of `targets`. */
+    int      num_nodes;   /**< Number of node ids. */
+    int      num_edges;   /**< Number of edges. */
+    bool     b_frozen;    /**< Whether the CSR arrays are built. */
+} Graph;
+
+/**
+ * @brief Callback listing the out-edges of a node of an implicit graph.
+ *
+ * @param node       Id of the node.
+ * @param neighbours Output for up to `GRAPH_MAX_IMPLICIT_DEGREE` successor
+ *                   ids.
+ * @param weights    Output for the weight of each edge.
+ * @param ctx        Caller-supplied context.
+ * @return The number of edges written.
+ */
+typedef int (*GraphNeighbourFn)(int   node,
+                                int  *neighbours,
+                                int  *weights,
+                                void *ctx);
 
 /**
- * @brief Structure to represent an graph with dynamic size.
+ * @brief Callback estimating the remaining distance from a node to the goal.
  *
- * The graph is capable of holding any data type, with the actual data stored as
- * void pointers.
+ * For A* to return shortest paths the estimate must never exceed the true
+ * distance, and must not drop by more than an edge's weight along it.
+ *
+ * @param node Id of the node.
+ * @param goal Id of the goal node.
+ * @param ctx  Caller-supplied context.
+ * @return The estimated distance.
+ */
+typedef long long (*GraphHeuristicFn)(int node, int goal, void *ctx);
+
+/**
+ * @brief Structure describing the graph a traversal runs over.
  */
 typedef struct
 {
-    void **list; /**< Pointer to the graph of elements.*/
-    int    idx;  /**< Current index (number of elements stored in the graph). */
-    int    max;  /**< Maximum capacity of the graph. */
-    ElementType ele_type; /**< The type of the elements stored in the graph. */
-} graph;
+    const Graph     *graph;      /**< Frozen graph, or NULL if implicit. */
+    GraphNeighbourFn neighbours; /**< Edge callback of an implicit graph. */
+    void            *ctx;        /**< Context passed to `neighbours`. */
+    int              num_nodes;  /**< Number of node ids. */
+    int              width;      /**< Columns of an implicit grid, or 0. */
+    int              height;     /**< Rows of an implicit grid, or 0. */
+} GraphSource;
 
 /**
- * @brief Initializes an empty graph.
+ * @brief Entry of the search priority queue.
+ */
+typedef struct
+{
+    long long key;  /**< Priority; smaller keys are popped first. */
+    int       node; /**< Id of the queued node. */
+} GraphHeapEntry;
+
+VECTOR_DEFINE(GraphHeap, graph_heap, GraphHeapEntry)
+
+/**
+ * @brief Structure holding the state and results of a traversal.
  *
- * This function allocates memory for the graph and sets up the initial
- * capacity. The elements are initialized to NULL to indicate empty slots.
+ * After a search, `dist[n]` is the distance of node `n` from the start (or
+ * `GRAPH_UNREACHABLE`) and `parent[n]` the previous node on a shortest path
+ * (or -1). The buffers are kept between searches and only grow.
+ */
+typedef struct
+{
+    long long *dist;      /**< Distance of every node from the start. */
+    int       *parent;    /**< Predecessor of every node on its path. */
+    BitMatrix *visited;   /**< One-row bitset of settled nodes. */
+    IntArray   frontier;  /**< Queue of nodes for breadth-first search. */
+    GraphHeap  heap;      /**< Binary min-heap for Dijkstra and A*. */
+    int        capacity;  /**< Number of nodes the buffers can hold. */
+    int        num_nodes; /**< Number of nodes of the last search. */
+} GraphSearch;
+
+/**
+ * @brief Initializes an empty graph.
  *
- * @param ele_type The type of elements stored in the graph.
  * @return Pointer to the newly created graph, or NULL on failure.
  */
-graph *graph_initialization(ElementType ele_type);
+Graph *graph_initialization(void);
 
 /**
  * @brief Destroys the graph, freeing allocated memory.
  *
- * This function frees the memory for both the graph and its elements.
- * Each element is assumed to have been dynamically allocated and will be freed.
- *
  * @param graph Pointer to the graph to be destroyed.
  */
-void graph_destroy(graph *graph);
+void graph_destroy(Graph *graph);
+
+/**
+ * @brief Adds a directed edge to a graph that is not yet frozen.
+ *
+ * The node count grows to include both ids.
+ *
+ * @param graph Pointer to the graph.
+ * @param from  Id of the source node; must not be negative.
+ * @param to    Id of the destination node; must not be negative.
+ * @return ERROR_SUCCESS on success, or an appropriate error code on failure.
+ */
+int graph_add_edge(Graph *graph, int from, int to);
+
+/**
+ * @brief Adds a weighted directed edge to a graph that is not yet frozen.
+ *
+ * Edges added with `graph_add_edge` have weight 1.
+ *
+ * @param graph  Pointer to the graph.
+ * @param from   Id of the source node; must not be negative.
+ * @param to     Id of the destination node; must not be negative.
+ * @param weight Weight of the edge; must not be negative.
+ * @return ERROR_SUCCESS on success, or an appropriate error code on failure.
+ */
+int graph_add_weighted_edge(Graph *graph, int from, int to, int weight);
+
+/**
+ * @brief Packs the accumulated edges into CSR adjacency.
+ *
+ * The edge list is released afterwards; no more edges can be added.
+ *
+ * @param graph Pointer to the graph.
+ * @return ERROR_SUCCESS on success, or an appropriate error code on failure.
+ */
+int graph_freeze(Graph *graph);
+
+/**
+ * @brief Returns the successors of a node in a frozen graph.
+ *
+ * @param graph Pointer to the frozen graph.
+ * @param node  Id of the node.
+ * @param count Output for the number of successors.
+ * @return Pointer to the successor ids, or NULL (with `*count` set to 0) if
+ * the input is invalid.
+ */
+const int *graph_neighbours(const Graph *graph, int node, int *count);
+
+/**
+ * @brief Checks whether a frozen graph has an edge.
+ *
+ * @param graph Pointer to the frozen graph.
+ * @param from  Id of the source node.
+ * @param to    Id of the destination node.
+ * @return `true` if the edge exists, `false` otherwise.
+ */
+bool graph_has_edge(const Graph *graph, int from, int to);
+
+/**
+ * @brief Topologically sorts a frozen graph with Kahn's algorithm.
+ *
+ * `order` receives every node id such that each edge leads from an earlier
+ * id to a later one. Ready nodes are emitted first-in, first-out, starting
+ * from the sources in ascending id order, so the order is deterministic.
+ *
+ * @param graph Pointer to the frozen graph.
+ * @param order Pointer to the `TYPE_INT` array receiving the order.
+ * @return ERROR_SUCCESS on success, ERROR_CYCLE_DETECTED if the graph has a
+ * cycle (`order` then holds only the nodes that precede it), or another
+ * appropriate error code on failure.
+ */
+int graph_topological_sort(const Graph *graph, Array *order);
+
+/**
+ * @brief Describes a frozen graph as a traversal source.
+ *
+ * @param graph Pointer to the frozen graph.
+ * @return The source.
+ */
+GraphSource graph_source_csr(const Graph *graph);
+
+/**
+ * @brief Describes an implicit grid graph as a traversal source.
+ *
+ * Cell `(row, col)` is node `GRAPH_GRID_NODE(width, row, col)`; its edges
+ * are listed by `neighbours`.
+ *
+ * @param width      Number of columns.
+ * @param height     Number of rows.
+ * @param neighbours Callback listing the edges of a cell.
+ * @param ctx        Context passed to `neighbours`.
+ * @return The source.
+ */
+GraphSource graph_source_grid(int              width,
+                              int              height,
+                              GraphNeighbourFn neighbours,
+                              void            *ctx);
+
+/**
+ * @brief Initializes an empty, reusable search state.
+ *
+ * @return Pointer to the newly created search state, or NULL on failure.
+ */
+GraphSearch *graph_search_initialization(void);
+
+/**
+ * @brief Destroys a search state, freeing allocated memory.
+ *
+ * @param search Pointer to the search state to be destroyed.
+ */
+void graph_search_destroy(GraphSearch *search);
+
+/**
+ * @brief Computes hop counts from a start node by breadth-first search.
+ *
+ * Edge weights are ignored.
+ *
+ * @param search Pointer to the search state receiving the results.
+ * @param source Pointer to the graph to search.
+ * @param start  Id of the start node.
+ * @return ERROR_SUCCESS on success, or an appropriate error code on failure.
+ */
+int graph_bfs(GraphSearch *search, const GraphSource *source, int start);
+
+/**
+ * @brief Computes shortest weighted distances with Dijkstra's algorithm.
+ *
+ * Edge weights must not be negative.
+ *
+ * @param search Pointer to the search state receiving the results.
+ * @param source Pointer to the graph to search.
+ * @param start  Id of the start node.
+ * @param goal   Id of a node at which to stop once it is settled, or -1 to
+ *               reach every node.
+ * @return ERROR_SUCCESS on success, or an appropriate error code on failure.
+ */
+int graph_dijkstra(GraphSearch       *search,
+                   const GraphSource *source,
+                   int                start,
+                   int                goal);
+
+/**
+ * @brief Computes a shortest path to a goal with A* search.
+ *
+ * Nodes are expanded in order of distance plus `heuristic` estimate, and
+ * the search stops once `goal` is settled. Only `dist` and `parent` entries
+ * of settled nodes are final.
+ *
+ * @param search    Pointer to the search state receiving the results.
+ * @param source    Pointer to the graph to search.
+ * @param start     Id of the start node.
+ * @param goal      Id of the goal node.
+ * @param heuristic Callback estimating the distance to `goal`.
+ * @param ctx       Context passed to `heuristic`.
+ * @return ERROR_SUCCESS on success, ERROR_ELEMENT_NOT_FOUND if the goal is
+ * unreachable, or another appropriate error code on failure.
+ */
+int graph_astar(GraphSearch       *search,
+                const GraphSource *source,
+                int                start,
+                int                goal,
+                GraphHeuristicFn   heuristic,
+                void              *ctx);
 
 #endif // GRAPH_H
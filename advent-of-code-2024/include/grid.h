@@ -0,0 +1,100 @@
+#ifndef GRID_H
+#define GRID_H
+
+#include <stddef.h>
+
+/**
+ * @file grid.h
+ * @brief Flat 2D grid utilities and definitions.
+ *
+ * This header file contains function declarations and macro definitions for
+ * the grid source file. A grid stores a rectangle of characters in one
+ * row-major buffer surrounded by a border of `pad` sentinel cells on every
+ * side. Any walk that stays within `pad` steps of the grid reads sentinels
+ * instead of leaving the buffer, so neighbour lookups need no bounds checks.
+ */
+
+/**
+ * @brief Structure to represent a padded character grid.
+ */
+typedef struct
+{
+    char *cells;    /**< Buffer of `stride * (height + 2 * pad)` cells. */
+    int   width;    /**< Number of columns, excluding padding. */
+    int   height;   /**< Number of rows, excluding padding. */
+    int   pad;      /**< Width of the sentinel border on each side. */
+    int   stride;   /**< Distance in cells between vertically adjacent cells. */
+    char  sentinel; /**< Value stored in every padding cell. */
+} Grid;
+
+/**
+ * @brief Accesses the cell at a row and column, without bounds checks.
+ *
+ * Rows and columns may range from `-pad` to `height - 1 + pad` and
+ * `width - 1 + pad` respectively; cells outside the grid hold the sentinel.
+ *
+ * @param grid Pointer to the grid.
+ * @param row  Row number.
+ * @param col  Column number.
+ */
+#define GRID_AT(grid, row, col)                                      \
+    ((grid)->cells[((ptrdiff_t)(row) + (grid)->pad) * (grid)->stride \
+                   + (col) + (grid)->pad])
+
+/**
+ * @brief Initializes a grid filled with the sentinel.
+ *
+ * @param width    Number of columns.
+ * @param height   Number of rows.
+ * @param pad      Width of the sentinel border on each side.
+ * @param sentinel Value of every cell, including the border.
+ * @return Pointer to the newly created grid, or NULL on failure.
+ */
+Grid *grid_initialization(int width, int height, int pad, char sentinel);
+
+/**
+ * @brief Builds a grid from newline-separated text.
+ *
+ * The grid is as wide as the longest line and has one row per line; a
+ * trailing `\r` on each line and a final trailing newline are ignored.
+ * Cells past the end of a shorter line hold the sentinel.
+ *
+ * @param buffer   Pointer to the text.
+ * @param len      Length of the text in bytes.
+ * @param pad      Width of the sentinel border on each side.
+ * @param sentinel Value of every padding cell.
+ * @return Pointer to the newly created grid, or NULL on failure.
+ */
+Grid *grid_from_buffer(const char *buffer, size_t len, int pad, char sentinel);
+
+/**
+ * @brief Builds a grid from the contents of a file.
+ *
+ * @param filename Path to the file.
+ * @param pad      Width of the sentinel border on each side.
+ * @param sentinel Value of every padding cell.
+ * @return Pointer to the newly created grid, or NULL on failure.
+ */
+Grid *grid_load(const char *filename, int pad, char sentinel);
+
+/**
+ * @brief Returns the buffer offset of one step in a direction.
+ *
+ * Adding the offset to a pointer at `&GRID_AT(grid, row, col)` moves it to
+ * `&GRID_AT(grid, row + drow, col + dcol)`.
+ *
+ * @param grid Pointer to the grid.
+ * @param drow Row step.
+ * @param dcol Column step.
+ * @return The offset in cells.
+ */
+ptrdiff_t grid_offset(const Grid *grid, int drow, int dcol);
+
+/**
+ * @brief Destroys the grid, freeing allocated memory.
+ *
+ * @param grid Pointer to the grid to be destroyed.
+ */
+void grid_destroy(Grid *grid);
+
+#endif // GRID_H
@@ -0,0 +1,64 @@
+#ifndef HISTOGRAM_H
+#define HISTOGRAM_H
+
+#include "array.h"
+
+#include <stdbool.h>
+
+/**
+ * @file histogram.h
+ * @brief Histogram (frequency count) utilities and definitions.
+ *
+ * This header file contains function declarations and macro definitions for
+ * the histogram source file. A histogram is built from an integer array in
+ * one pass and then answers "how often does this value appear" in O(1).
+ */
+
+/**
+ * @brief Extra slots, beyond the element count, a dense table may use.
+ *
+ * Values are counted in a dense table indexed by `value - min` when the
+ * value range is at most `2 * count + HISTOGRAM_DENSE_SLACK`; sparser
+ * inputs fall back to a hash table.
+ */
+#define HISTOGRAM_DENSE_SLACK 1024
+
+/**
+ * @brief Structure to represent a histogram of integer values.
+ */
+typedef struct
+{
+    int  *counts;   /**< Count per slot. */
+    int  *keys;     /**< Value held by each hash slot; NULL when dense. */
+    int   min;      /**< Smallest value, the base of a dense table. */
+    int   capacity; /**< Number of slots. */
+    int   shift;    /**< 32 minus log2 of `capacity`, for hashing. */
+    bool  b_dense;  /**< Whether slots are indexed directly by value. */
+} Histogram;
+
+/**
+ * @brief Builds a histogram of an integer array.
+ *
+ * @param array Pointer to an array of `TYPE_INT`.
+ * @return Pointer to the newly created histogram, or NULL on failure.
+ */
+Histogram *array_histogram(const Array *array);
+
+/**
+ * @brief Returns how many times a value was counted.
+ *
+ * @param hist  Pointer to the histogram.
+ * @param value Value to look up.
+ * @return The number of occurrences of `value`, or 0 if it never appears
+ * or the histogram is NULL.
+ */
+int histogram_count(const Histogram *hist, int value);
+
+/**
+ * @brief Destroys the histogram, freeing allocated memory.
+ *
+ * @param hist Pointer to the histogram to be destroyed.
+ */
+void histogram_destroy(Histogram *hist);
+
+#endif // HISTOGRAM_H
@@ -0,0 +1,100 @@
+#ifndef INPUT_H
+#define INPUT_H
+
+#include "cursor.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+
+/**
+ * @file input.h
+ * @brief Input file utilities and definitions.
+ *
+ * This header file contains function declarations and macro definitions for
+ * the input source file. An input file is loaded whole: regular files are
+ * memory-mapped read-only, and anything that cannot be mapped (pipes,
+ * character devices, empty files) is read into a heap buffer instead. Either
+ * way the solver sees one contiguous, NUL-terminated run of bytes, with no
+ * stdio buffering or per-line copies in between.
+ *
+ * Solvers that only need one line at a time open the input as a stream
+ * instead. Regular files are still mapped, but pipes are then read in
+ * chunks of `INPUT_STREAM_CHUNK` bytes, carrying a partial line over to the
+ * next chunk, so memory stays bounded by the chunk size or the longest line
+ * however large the input is.
+ */
+
+/**
+ * @brief Bytes read at a time from a stream that cannot be mapped.
+ */
+#define INPUT_STREAM_CHUNK (1024 * 1024)
+
+/**
+ * @brief File name that opens standard input instead of a file.
+ */
+#define INPUT_STDIN "-"
+
+/**
+ * @brief Structure holding the contents of an input file.
+ */
+typedef struct
+{
+    const char *data;     /**< Contents, or a stream's buffered window. */
+    size_t      size;     /**< Length of `data` in bytes. */
+    size_t      pos;      /**< Offset of the next unread line in `data`. */
+    void       *map;      /**< Start of the file mapping, or NULL. */
+    size_t      map_size; /**< Length of the file mapping in bytes. */
+    char       *buffer;   /**< Heap copy or stream window, or NULL. */
+    size_t      capacity; /**< Size of `buffer` in bytes. */
+    int         fd;       /**< Descriptor of a chunked stream, or -1. */
+    int         status;   /**< ERROR_SUCCESS, or the error that ended it. */
+} Input;
+
+/**
+ * @brief Opens and loads an input file.
+ *
+ * The whole contents are available through `data` and `size`, followed by
+ * a NUL byte.
+ *
+ * @param filename Path of the file to load, or `INPUT_STDIN`.
+ * @return Pointer to the loaded input, or NULL on failure.
+ */
+Input *input_open(const char *filename);
+
+/**
+ * @brief Opens an input file for reading line by line.
+ *
+ * Only `input_next_line` may be used to read the contents; `data` is not
+ * NUL-terminated and, for a chunked stream, holds only a window of the
+ * input.
+ *
+ * @param filename Path of the file to open, or `INPUT_STDIN`.
+ * @return Pointer to the opened input, or NULL on failure.
+ */
+Input *input_open_stream(const char *filename);
+
+/**
+ * @brief Releases an input, unmapping or freeing its contents.
+ *
+ * Every pointer into the contents becomes invalid.
+ *
+ * @param input Pointer to the input to be released.
+ */
+void input_close(Input *input);
+
+/**
+ * @brief Returns the next line of an input without copying it.
+ *
+ * The line ending ("\n" or "\r\n") is not part of the line, so the line is
+ * not NUL-terminated. A final line without a line ending is still returned.
+ * Lines of any length are returned whole. For a chunked stream the line
+ * stays valid only until the next call.
+ *
+ * @param input Pointer to the input.
+ * @param line  Output for the line.
+ * @return `true` if a line was returned, `false` at the end of the input or
+ * if reading failed, in which case `status` holds the error.
+ */
+bool input_next_line(Input *input, Span *line);
+
+#endif // INPUT_H
@@ -0,0 +1,80 @@
+#ifndef KERNEL_H
+#define KERNEL_H
+
+/**
+ * @file kernel.h
+ * @brief Reduction kernels over contiguous integer buffers.
+ *
+ * This header file contains function declarations for the kernel source
+ * file. Each kernel walks a plain `int` buffer (such as `Array` data of
+ * `TYPE_INT` or an `IntArray`) and reduces it to a single value. The
+ * kernels are vectorized with AVX2 or SSE2 when the compiler targets them
+ * (see `ARCH_FLAGS` in the Makefile) and fall back to scalar loops
+ * otherwise. Sums are accumulated in 64 bits, so they do not overflow for
+ * any realistic buffer length.
+ */
+
+/**
+ * @brief Sums the elements of a buffer.
+ *
+ * @param a Pointer to the elements.
+ * @param n Number of elements.
+ * @return The sum of all elements, or 0 if the input is empty.
+ */
+long long kernel_sum_int(const int *a, int n);
+
+/**
+ * @brief Computes the dot product of two buffers.
+ *
+ * @param a Pointer to the first buffer.
+ * @param b Pointer to the second buffer.
+ * @param n Number of elements in each buffer.
+ * @return The sum of `a[i] * b[i]`, or 0 if the input is empty.
+ */
+long long kernel_dot_int(const int *a, const int *b, int n);
+
+/**
+ * @brief Computes the dot product of two buffers under a mask.
+ *
+ * @param a    Pointer to the first buffer.
+ * @param b    Pointer to the second buffer.
+ * @param mask Pointer to the mask; element `i` counts only if `mask[i]`
+ *             is nonzero.
+ * @param n    Number of elements in each buffer.
+ * @return The sum of `a[i] * b[i]` over the selected elements, or 0 if the
+ * input is empty.
+ */
+long long kernel_dot_masked_int(const int *a,
+                                const int *b,
+                                const int *mask,
+                                int        n);
+
+/**
+ * @brief Computes the sum of absolute differences of two buffers.
+ *
+ * @param a Pointer to the first buffer.
+ * @param b Pointer to the second buffer.
+ * @param n Number of elements in each buffer.
+ * @return The sum of `|a[i] - b[i]|`, or 0 if the input is empty.
+ */
+long long kernel_sad_int(const int *a, const int *b, int n);
+
+/**
+ * @brief Finds the smallest element of a buffer.
+ *
+ * @param a Pointer to the elements.
+ * @param n Number of elements.
+ * @return The smallest element, or INT_MAX if the input is empty.
+ */
+int kernel_min_int(const int *a, int n);
+
+/**
+ * @brief Finds the largest element of a buffer.
+ *
+ * @param a Pointer to the elements.
+ * @param n Number of elements.
+ * @return The largest element, or INT_MIN if the input is empty.
+ */
+int kernel_max_int(const int *a, int n);
+
+#endif // KERNEL_H
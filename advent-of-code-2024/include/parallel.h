@@ -0,0 +1,111 @@
+#ifndef PARALLEL_H
+#define PARALLEL_H
+
+#include "array.h"
+
+/**
+ * @file parallel.h
+ * @brief Parallel map/reduce utilities and definitions.
+ *
+ * This header file contains function declarations and macro definitions for
+ * the parallel source file. An array is split into contiguous chunks, one per
+ * worker thread, and a callback is run on each chunk. Callbacks run
+ * concurrently, so they must only read the array and write state private to
+ * their own chunk.
+ */
+
+/**
+ * @brief Upper bound on the number of worker threads used for one call.
+ */
+#define PARALLEL_MAX_THREADS 64
+
+/**
+ * @brief Smallest number of elements worth handing to a worker thread.
+ *
+ * Arrays shorter than this run on the calling thread only, and longer
+ * arrays never get more threads than they have chunks of this size.
+ */
+#define PARALLEL_MIN_CHUNK 16384
+
+/**
+ * @brief Callback applied to one chunk of an array.
+ *
+ * @param array Array being processed.
+ * @param start Index of the first element of the chunk.
+ * @param end   Index one past the last element of the chunk.
+ * @param ctx   Caller-supplied context.
+ */
+typedef void (*ArrayChunkFn)(const Array *array, int start, int end, void *ctx);
+
+/**
+ * @brief Callback reducing one chunk of an array to a partial result.
+ *
+ * @param array Array being processed.
+ * @param start Index of the first element of the chunk.
+ * @param end   Index one past the last element of the chunk.
+ * @param ctx   Caller-supplied context.
+ * @return The partial result for the chunk.
+ */
+typedef long long (*ArrayReduceFn)(const Array *array,
+                                   int          start,
+                                   int          end,
+                                   void        *ctx);
+
+/**
+ * @brief Combines two partial results into one.
+ *
+ * Must be associative; partial results are combined in chunk order.
+ */
+typedef long long (*ArrayCombineFn)(long long lhs, long long rhs);
+
+/**
+ * @brief Returns the number of worker threads available.
+ *
+ * @return The count set with `parallel_set_thread_count`, or else the
+ * number of online processors, clamped to [1, `PARALLEL_MAX_THREADS`].
+ */
+int parallel_thread_count(void);
+
+/**
+ * @brief Overrides the number of worker threads used by later calls.
+ *
+ * Chunks still never get shorter than `PARALLEL_MIN_CHUNK`. This lets the
+ * threaded path run on a single processor, e.g. in tests; it must not be
+ * called while a parallel call is running.
+ *
+ * @param count Number of threads, or 0 to use the processor count again.
+ */
+void parallel_set_thread_count(int count);
+
+/**
+ * @brief Runs a callback over every chunk of an array in parallel.
+ *
+ * Returns once every chunk has been processed.
+ *
+ * @param array Pointer to the array to process.
+ * @param fn    Callback run once per chunk.
+ * @param ctx   Context passed to every callback.
+ * @return ERROR_SUCCESS on success, or an appropriate error code on failure.
+ */
+int array_parallel_for(const Array *array, ArrayChunkFn fn, void *ctx);
+
+/**
+ * @brief Reduces an array to a single value in parallel.
+ *
+ * Each chunk is reduced by `fn` and the partial results are folded
+ * together with `combine`. An empty array reduces to 0.
+ *
+ * @param array   Pointer to the array to reduce.
+ * @param fn      Callback reducing one chunk.
+ * @param combine Callback combining partial results, or NULL to add them.
+ * @param ctx     Context passed to every callback.
+ * @param result  Output for the reduced value.
+ * @return ERROR_SUCCESS on success, or an appropriate error code on failure.
+ */
+int array_parallel_reduce(const Array   *array,
+                          ArrayReduceFn  fn,
+                          ArrayCombineFn combine,
+                          void          *ctx,
+                          long long     *result);
+
+#endif // PARALLEL_H
@@ -0,0 +1,73 @@
+#ifndef PARSE_H
+#define PARSE_H
+
+/**
+ * @file parse.h
+ * @brief Decimal integer parsing utilities and definitions.
+ *
+ * This header file contains function declarations and macro definitions for
+ * the parse source file. The parsers read from a bounded buffer `[str,
+ * end)` that need not be NUL-terminated, and report where the number ended
+ * the way `strtol` does. Digits are converted eight at a time within a
+ * 64-bit word (SWAR), and `parse_fixed` uses SSE4.1 when the compiler
+ * targets it (see `ARCH_FLAGS` in the Makefile); both fall back to scalar
+ * loops otherwise.
+ */
+
+/**
+ * @brief Widest digit run accepted by `parse_fixed`.
+ */
+#define PARSE_FIXED_MAX_WIDTH 16
+
+/**
+ * @brief Parses a signed decimal integer.
+ *
+ * Accepts an optional '+' or '-' followed by one or more digits. Unlike
+ * `strtol`, leading whitespace is not skipped. On overflow the value
+ * saturates to `LONG_MIN` or `LONG_MAX` and every digit is still consumed.
+ *
+ * @param str   Pointer to the first character.
+ * @param end   Pointer one past the last readable character.
+ * @param value Output for the parsed value.
+ * @param next  Output for the first character after the number, or `str`
+ *              if no number was found; may be NULL.
+ * @return ERROR_SUCCESS on success, ERROR_INVALID_INPUT if there are no
+ * digits, or ERROR_OUT_OF_RANGE on overflow.
+ */
+int parse_long(const char  *str,
+               const char  *end,
+               long        *value,
+               const char **next);
+
+/**
+ * @brief Parses a signed decimal integer that must fit in an `int`.
+ *
+ * Behaves like `parse_long`, saturating to `INT_MIN` or `INT_MAX`.
+ *
+ * @param str   Pointer to the first character.
+ * @param end   Pointer one past the last readable character.
+ * @param value Output for the parsed value.
+ * @param next  Output for the first character after the number, or `str`
+ *              if no number was found; may be NULL.
+ * @return ERROR_SUCCESS on success, ERROR_INVALID_INPUT if there are no
+ * digits, or ERROR_OUT_OF_RANGE on overflow.
+ */
+int parse_int(const char *str, const char *end, int *value, const char **next);
+
+/**
+ * @brief Parses an unsigned decimal field of a known width.
+ *
+ * Exactly `width` digits must be present and must not be followed by
+ * another digit. Meant for column-aligned inputs whose fields all share one
+ * width; with SSE4.1 the whole field is converted in a handful of
+ * instructions whenever 16 bytes can be read from `str`.
+ *
+ * @param str   Pointer to the first digit.
+ * @param end   Pointer one past the last readable character.
+ * @param width Number of digits, from 1 to `PARSE_FIXED_MAX_WIDTH`.
+ * @param value Output for the parsed value.
+ * @return ERROR_SUCCESS on success, or an appropriate error code on failure.
+ */
+int parse_fixed(const char *str, const char *end, int width, long long *value);
+
+#endif // PARSE_H
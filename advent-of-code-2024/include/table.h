@@ -3,6 +3,8 @@
 
 #include "array.h"
 
+#include <stdbool.h>
+
 /**
  * @file table.h
  * @brief Table utilities and definitions.
@@ -14,14 +16,27 @@
 /**
  * @brief Structure to represent an table.
  *
- * The table contains rows of matching data type.
+ * The table contains rows of matching data type. Rows are stored as a ring:
+ * logical row `r` lives in slot `(head + r) % num_rows` of `content`, so the
+ * oldest row can be recycled as the newest by moving `head` alone.
  */
 typedef struct
 {
     Array **content;  /**< Contains the arrays within the table. */
     int     num_rows; /**< Number of rows within the table. */
+    int     head;     /**< Slot of `content` holding logical row 0. */
+    Arena  *arena;    /**< Arena owning the table, or NULL if heap allocated. */
 } Table;
 
+/**
+ * @brief Returns the array holding a logical row, without bounds checks.
+ *
+ * @param table Pointer to the table.
+ * @param row   Logical row number, in `[0, num_rows)`.
+ */
+#define TABLE_ROW(table, row) \
+    ((table)->content[((table)->head + (row)) % (table)->num_rows])
+
 /**
  * @brief Initializes an empty table.
  *
@@ -34,15 +49,42 @@ typedef struct
  */
 Table *table_initialization(ElementType ele_type, int num_rows);
 
+/**
+ * @brief Initializes an empty table inside an arena.
+ *
+ * The table structure, its row list and every row are carved out of
+ * `arena`. `table_destroy` is a no-op for such tables; they are released
+ * together with the arena.
+ *
+ * @param ele_type The type of elements stored in the array.
+ * @param num_rows The number of rows within the table.
+ * @param arena    Pointer to the arena that owns the table.
+ * @return Pointer to the newly created table, or NULL on failure.
+ */
+Table *table_initialization_arena(ElementType ele_type,
+                                  int         num_rows,
+                                  Arena      *arena);
+
 /**
  * @brief Destroys the table, freeing allocated memory.
  *
- * This function frees the memory for both the table and its content.
+ * This function frees the memory for both the table and its content. Tables
+ * created from an arena are left untouched.
  *
  * @param table Pointer to the table to be destroyed.
  */
 void table_destroy(Table *table);
 
+/**
+ * @brief Returns the array holding a logical row.
+ *
+ * @param table Pointer to the table.
+ * @param row   Logical row number.
+ * @return Pointer to the row, or NULL if the input is invalid or the row is
+ * out of bounds.
+ */
+Array *table_get_row(const Table *table, int row);
+
 /**
  * @brief Adds an element to the table.
  *
@@ -58,9 +100,9 @@ int table_add_element(Table *table, int row, const void *ele);
 /**
  * @brief Resets all elements within a specific row within the table.
  *
- * This function resets all elements in the row by freeing any allocated
- * memory for each element and setting the pointers to `NULL`. The row itself
- * remains allocated with its current capacity.
+ * This function empties the row by setting its element count to zero, in
+ * constant time; elements are stored inline, so there is nothing to free.
+ * The row itself remains allocated with its current capacity.
  *
  * @param table Pointer to the table.
  * @param row   Row number to indate array to be reset.
@@ -85,6 +127,130 @@ int table_reset_row(Table *table, int row);
  */
 int table_copy_row(Table *table, int src, int dst);
 
+/**
+ * @brief Exchanges two rows of the table in O(1).
+ *
+ * Only the row handles are exchanged; no elements are copied.
+ *
+ * @param table Pointer to the table.
+ * @param a     Row number of the first row.
+ * @param b     Row number of the second row.
+ * @return ERROR_SUCCESS on success, or an appropriate error code on failure.
+ */
+int table_swap_rows(Table *table, int a, int b);
+
+/**
+ * @brief Rotates every row of the table up by one in O(1).
+ *
+ * Row `i + 1` becomes row `i`, and the former first row becomes the last
+ * row with its contents intact. Only the ring's head moves.
+ *
+ * @param table Pointer to the table.
+ * @return ERROR_SUCCESS on success, or an appropriate error code on failure.
+ */
+int table_rotate_rows(Table *table);
+
+/**
+ * @brief Replaces the contents of a row with a buffer of elements.
+ *
+ * The elements are copied in a single `memcpy`. For `TYPE_CHAR` rows a
+ * trailing line ending (`\n`, `\r\n` or `\r`) is dropped, so a line read
+ * by `fgets` can be loaded as is. On failure the row is left unchanged.
+ *
+ * @param table Pointer to the table.
+ * @param row   Row number of the row to fill.
+ * @param eles  Pointer to the elements.
+ * @param count Number of elements in the buffer.
+ * @return ERROR_SUCCESS on success, or an appropriate error code on failure.
+ */
+int table_set_row_from_buffer(Table      *table,
+                              int         row,
+                              const void *eles,
+                              int         count);
+
+/**
+ * @brief Pushes a new last row, dropping the first (oldest) row.
+ *
+ * The oldest row's storage is reused for the new row, which is filled by
+ * `table_set_row_from_buffer`. A table used as a rolling window over a
+ * stream therefore only copies the `count` new elements. On failure the
+ * table is left unchanged.
+ *
+ * @param table Pointer to the table.
+ * @param eles  Pointer to the elements of the new row.
+ * @param count Number of elements in the new row.
+ * @return ERROR_SUCCESS on success, or an appropriate error code on failure.
+ */
+int table_push_row(Table *table, const void *eles, int count);
+
+/**
+ * @brief Returns the length of the table's longest row.
+ *
+ * @param table Pointer to the table.
+ * @return The number of elements in the longest row, or 0 if the table is
+ * NULL.
+ */
+int table_width(const Table *table);
+
+/**
+ * @brief Materializes the transpose of a table.
+ *
+ * Row `c` of `dst` holds column `c` of `src`, top to bottom, so a column
+ * walk over `src` becomes a contiguous scan of one `dst` row. Rows of `src`
+ * shorter than `table_width(src)` are padded with `fill`.
+ *
+ * `dst` gains rows as needed, up to `table_width(src)`; any further rows
+ * are emptied. Its previous contents are discarded.
+ *
+ * @param src  Pointer to the table to transpose.
+ * @param dst  Pointer to the table receiving the transpose; must differ from
+ *             `src` and hold the same element type.
+ * @param fill Pointer to the element used to pad short rows.
+ * @return ERROR_SUCCESS on success, or an appropriate error code on failure.
+ */
+int table_transpose(const Table *src, Table *dst, const void *fill);
+
+/**
+ * @brief Materializes every diagonal of a table as a row.
+ *
+ * For a table of `R` rows and width `C`, `dst` gets `R + C - 1` rows.
+ * Diagonal `k` starts at the cell given by `table_diagonal_start` and runs
+ * down-right, or down-left when `b_anti` is set, until it leaves the table.
+ * Rows of `src` shorter than `C` are padded with `fill`.
+ *
+ * `dst` gains rows as needed; any further rows are emptied. Its previous
+ * contents are discarded.
+ *
+ * @param src    Pointer to the table to read.
+ * @param dst    Pointer to the table receiving the diagonals; must differ
+ *               from `src` and hold the same element type.
+ * @param b_anti Whether to collect down-left rather than down-right
+ *               diagonals.
+ * @param fill   Pointer to the element used to pad short rows.
+ * @return ERROR_SUCCESS on success, or an appropriate error code on failure.
+ */
+int table_diagonals(const Table *src,
+                    Table       *dst,
+                    bool         b_anti,
+                    const void  *fill);
+
+/**
+ * @brief Locates the first cell of a diagonal produced by
+ * `table_diagonals`.
+ *
+ * Element `i` of the diagonal lies at `(row + i, col + i)`, or at
+ * `(row + i, col - i)` for an anti-diagonal.
+ *
+ * @param num_rows Number of rows of the source table.
+ * @param width    Width of the source table.
+ * @param diagonal Diagonal number, in `[0, num_rows + width - 1)`.
+ * @param b_anti   Whether the diagonal is an anti-diagonal.
+ * @param row      Output for the row of the first cell.
+ * @param col      Output for the column of the first cell.
+ */
+void table_diagonal_start(
+    int num_rows, int width, int diagonal, bool b_anti, int *row, int *col);
+
 /**
  * @brief Prints the contents of a table.
  *
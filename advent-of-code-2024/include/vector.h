@@ -0,0 +1,136 @@
+#ifndef VECTOR_H
+#define VECTOR_H
+
+#include "aux.h"
+#include "error.h"
+
+#include <limits.h>
+#include <stdlib.h>
+
+/**
+ * @file vector.h
+ * @brief Compile-time typed vector generator.
+ *
+ * `VECTOR_DEFINE` stamps out a growable array specialised for one element
+ * type, the C analogue of a template. Unlike `Array`, the element type is
+ * known at compile time: there is no runtime type switch, elements are read
+ * as plain `type` values, and loops over `data` can be inlined and
+ * vectorized by the compiler. All functions are `static inline`, so each
+ * instantiation lives entirely in this header.
+ *
+ * Instantiating `VECTOR_DEFINE(IntArray, int_array, int)` generates the
+ * `IntArray` type together with:
+ *  - `int_array_init`    - set up an empty vector (no allocation).
+ *  - `int_array_destroy` - free the element buffer.
+ *  - `int_array_reserve` - grow the buffer to a minimum capacity.
+ *  - `int_array_push`    - append one element.
+ *  - `int_array_get`     - read an element by value.
+ *  - `int_array_reset`   - empty the vector, keeping its capacity.
+ */
+
+/**
+ * @brief Capacity of a vector's first element buffer.
+ */
+#define VECTOR_INITIAL_SIZE 16
+
+/**
+ * @brief Defines a typed vector and its functions.
+ *
+ * @param Name   Name of the generated structure type.
+ * @param prefix Prefix of the generated function names.
+ * @param type   Element type stored in the vector.
+ */
+#define VECTOR_DEFINE(Name, prefix, type)                                   \
+    typedef struct                                                          \
+    {                                                                       \
+        type *data; /**< Contiguous element buffer. */                      \
+        int   idx;  /**< Number of elements stored. */                      \
+        int   max;  /**< Capacity of the buffer, in elements. */            \
+    } Name;                                                                 \
+                                                                            \
+    static inline void prefix##_init(Name *vec)                             \
+    {                                                                       \
+        vec->data = NULL;                                                   \
+        vec->idx  = 0;                                                      \
+        vec->max  = 0;                                                      \
+    }                                                                       \
+                                                                            \
+    static inline void prefix##_destroy(Name *vec)                          \
+    {                                                                       \
+        if (NULL != vec)                                                    \
+        {                                                                   \
+            free(vec->data);                                                \
+            prefix##_init(vec);                                             \
+        }                                                                   \
+    }                                                                       \
+                                                                            \
+    static inline int prefix##_reserve(Name *vec, int capacity)             \
+    {                                                                       \
+        if (capacity <= vec->max)                                           \
+        {                                                                   \
+            return ERROR_SUCCESS;                                           \
+        }                                                                   \
+                                                                            \
+        size_t bytes    = (size_t)capacity * sizeof(type);                  \
+        type  *new_data = realloc(vec->data, bytes);                        \
+                                                                            \
+        if (NULL == new_data)                                               \
+        {                                                                   \
+            ERROR_LOG("Failed realloc: unable to allocate memory");         \
+            return ERROR_OUT_OF_MEMORY;                                     \
+        }                                                                   \
+                                                                            \
+        vec->data = new_data;                                               \
+        vec->max  = capacity;                                               \
+        return ERROR_SUCCESS;                                               \
+    }                                                                       \
+                                                                            \
+    static inline int prefix##_push(Name *vec, type value)                  \
+    {                                                                       \
+        if (INT_MAX == vec->idx)                                            \
+        {                                                                   \
+            ERROR_LOG("Failed push: vector is at its maximum size");        \
+            return ERROR_OUT_OF_MEMORY;                                     \
+        }                                                                   \
+                                                                            \
+        if (vec->idx >= vec->max)                                           \
+        {                                                                   \
+            /* Doubling stops at INT_MAX rather than overflowing */         \
+            int capacity = (0 == vec->max)          ? VECTOR_INITIAL_SIZE   \
+                           : (INT_MAX / 2 < vec->max) ? INT_MAX             \
+                                                      : vec->max * 2;       \
+                                                                            \
+            if (ERROR_SUCCESS != prefix##_reserve(vec, capacity))           \
+            {                                                               \
+                return ERROR_OUT_OF_MEMORY;                                 \
+            }                                                               \
+        }                                                                   \
+                                                                            \
+        vec->data[vec->idx++] = value;                                      \
+        return ERROR_SUCCESS;                                               \
+    }                                                                       \
+                                                                            \
+    static inline type prefix##_get(const Name *vec, int index)             \
+    {                                                                       \
+        return vec->data[index];                                            \
+    }                                                                       \
+                                                                            \
+    static inline void prefix##_reset(Name *vec)                            \
+    {                                                                       \
+        vec->idx = 0;                                                       \
+    }
+
+/**
+ * @brief Integer coordinate on a 2D grid.
+ */
+typedef struct
+{
+    int x; /**< Column (x-axis). */
+    int y; /**< Row (y-axis). */
+} Point;
+
+VECTOR_DEFINE(IntArray, int_array, int)
+VECTOR_DEFINE(CharArray, char_array, char)
+VECTOR_DEFINE(PointArray, point_array, Point)
+
+#endif // VECTOR_H
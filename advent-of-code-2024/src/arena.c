@@ -0,0 +1,184 @@
+#include "arena.h"
+#include "aux.h"
+#include "error.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+
+/**
+ * @file arena.c
+ * @brief Arena functions.
+ *
+ * This file contains functions handle all arena functions. Memory is carved
+ * out of large blocks by bumping an offset, so allocation is a pointer
+ * increment and teardown touches each block once rather than each object.
+ */
+
+/**
+ * @brief A single block of arena memory.
+ *
+ * The usable memory directly follows the block header.
+ */
+struct ArenaBlock
+{
+    ArenaBlock *next; /**< Next block in the chain, or NULL. */
+    size_t      size; /**< Usable capacity of the block in bytes. */
+    size_t      used; /**< Bytes handed out from the block so far. */
+};
+
+/* Function Prototypes */
+static ArenaBlock *arena_block_create(size_t size);
+static char       *arena_block_base(ArenaBlock *block);
+
+/**
+ * @brief Returns the first aligned address of a block's usable memory.
+ *
+ * @param block Pointer to the block.
+ * @return Pointer to the start of the usable memory.
+ */
+static char *
+arena_block_base (ArenaBlock *block)
+{
+    uintptr_t base = (uintptr_t)(block + 1);
+
+    base = (base + (ARENA_ALIGNMENT - 1)) & ~(uintptr_t)(ARENA_ALIGNMENT - 1);
+    return (char *)base;
+}
+
+/**
+ * @brief Allocates a new, empty arena block.
+ *
+ * @param size Usable capacity of the block in bytes.
+ * @return Pointer to the new block, or NULL on failure.
+ */
+static ArenaBlock *
+arena_block_create (size_t size)
+{
+    ArenaBlock *block = malloc(sizeof(ArenaBlock) + ARENA_ALIGNMENT + size);
+
+    if (NULL == block)
+    {
+        ERROR_LOG("Failed malloc: unable to allocate memory");
+        return NULL;
+    }
+
+    block->next = NULL;
+    block->size = size;
+    block->used = 0;
+    return block;
+}
+
+Arena *
+arena_initialization (size_t block_size)
+{
+    Arena *arena = calloc(1, sizeof(Arena));
+
+    if (NULL == arena)
+    {
+        ERROR_LOG("Failed calloc: unable to allocate memory");
+        goto EXIT;
+    }
+
+    arena->block_size = (0 == block_size) ? ARENA_DEFAULT_BLOCK_SIZE
+                                          : block_size;
+    arena->head       = arena_block_create(arena->block_size);
+
+    if (NULL == arena->head)
+    {
+        free(arena);
+        arena = NULL;
+        goto EXIT;
+    }
+
+    arena->current = arena->head;
+
+EXIT:
+    return arena;
+}
+
+void
+arena_destroy (Arena *arena)
+{
+    if (NULL != arena)
+    {
+        ArenaBlock *block = arena->head;
+
+        while (NULL != block)
+        {
+            ArenaBlock *next = block->next;
+            free(block);
+            block = next;
+        }
+
+        arena->head    = NULL;
+        arena->current = NULL;
+
+        free(arena);
+        arena = NULL;
+    }
+}
+
+void *
+arena_alloc (Arena *arena, size_t size)
+{
+    void *ptr = NULL;
+
+    if ((NULL == arena) || (NULL == arena->current))
+    {
+        ERROR_LOG("Invalid input to arena_alloc: input is NULL");
+        goto EXIT;
+    }
+
+    // Round every request up so the next allocation stays aligned
+    size = (size + (ARENA_ALIGNMENT - 1)) & ~(size_t)(ARENA_ALIGNMENT - 1);
+
+    ArenaBlock *block = arena->current;
+
+    if (block->size - block->used < size)
+    {
+        // Reuse the next block left over from before a reset if it fits
+        if ((NULL != block->next) && (block->next->size >= size))
+        {
+            block       = block->next;
+            block->used = 0;
+        }
+        else
+        {
+            ArenaBlock *fresh = arena_block_create(
+                (size > arena->block_size) ? size : arena->block_size);
+
+            if (NULL == fresh)
+            {
+                goto EXIT;
+            }
+
+            fresh->next = block->next;
+            block->next = fresh;
+            block       = fresh;
+        }
+
+        arena->current = block;
+    }
+
+    ptr = arena_block_base(block) + block->used;
+    block->used += size;
+
+EXIT:
+    return ptr;
+}
+
+int
+arena_reset (Arena *arena)
+{
+    if ((NULL == arena) || (NULL == arena->head))
+    {
+        ERROR_LOG("Invalid input to arena_reset: input is NULL");
+        return ERROR_NULL_POINTER;
+    }
+
+    arena->current    = arena->head;
+    arena->head->used = 0;
+    return ERROR_SUCCESS;
+}
+
+/*** end of file ***/
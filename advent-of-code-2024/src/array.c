@@ -2,6 +2,8 @@
 #include "aux.h"
 #include "error.h"
 
+#include <limits.h>
+#include <stdbool.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -11,86 +13,288 @@
  * @brief Arrray functions.
  *
  * This file contains functions handle all array functions. The array
- * is dynamically allocated and can store any data type using a `void *`
- * pointer.
+ * is dynamically allocated and stores its elements unboxed in a single
+ * contiguous buffer, so any fixed-size data type can be held. Short arrays
+ * live entirely in the inline buffer of the structure.
  */
 
-#define ARRAY_INITIAL_SIZE 10
+#define ARRAY_INITIAL_SIZE     10
+#define ARRAY_SORT_STACK_BYTES 256
+#define RADIX_BITS             8
+#define RADIX_BUCKETS          (1 << RADIX_BITS)
+#define RADIX_PASSES           ((int)(sizeof(int) * 8) / RADIX_BITS)
+#define RADIX_SIGN_BIT         (1u << (sizeof(int) * 8 - 1))
 
 /* Function Prototypes */
-static int array_resize(Array *array);
+static int    array_resize(Array *array);
+static size_t array_element_size(ElementType ele_type);
+static Array *array_create(ElementType ele_type,
+                           size_t      ele_size,
+                           Arena      *arena);
+static void  *array_alloc_buffer(Array *array, int capacity);
+static void   array_setup(Array      *array,
+                          ElementType ele_type,
+                          size_t      ele_size,
+                          Arena      *arena);
+static bool   b_is_inline(const Array *array);
+static int    radix_sort_int(int *values, int *payload, int count);
+static int    merge_sort(Array *array, ArrayCompareCtx compare, void *ctx);
+static int    compare_plain(const void *lhs, const void *rhs, void *ctx);
+static int    lower_bound_int(const int *values, int count, int key);
+static int    array_bound(const Array *array,
+                          const void  *key,
+                          ArrayCompare compare,
+                          bool         b_upper);
 
-Array *
-array_initialization (ElementType ele_type)
+/**
+ * @brief Returns the size in bytes of a built-in element type.
+ *
+ * @param ele_type The type of elements stored in the array.
+ * @return The element size, or 0 if the type has no implicit size.
+ */
+static size_t
+array_element_size (ElementType ele_type)
 {
-    Array *array = calloc(1, sizeof(Array));
+    size_t ele_size = 0;
 
-    if (NULL == array)
+    switch (ele_type)
     {
-        ERROR_LOG("Failed calloc: unable to allocate memory");
-        goto EXIT;
+        case TYPE_INT:
+            ele_size = sizeof(int);
+            break;
+        case TYPE_FLOAT:
+            ele_size = sizeof(float);
+            break;
+        case TYPE_DOUBLE:
+            ele_size = sizeof(double);
+            break;
+        case TYPE_CHAR:
+            ele_size = sizeof(char);
+            break;
+        case TYPE_INT_PTR:
+            ele_size = sizeof(int *);
+            break;
+        default:
+            break;
+    }
+
+    return ele_size;
+}
+
+/**
+ * @brief Allocates an element buffer for the array from its backing store.
+ *
+ * @param array    Pointer to the array the buffer is for.
+ * @param capacity Number of elements the buffer must hold.
+ * @return Pointer to the new buffer, or NULL on failure.
+ */
+static void *
+array_alloc_buffer (Array *array, int capacity)
+{
+    size_t bytes = (size_t)capacity * array->ele_size;
+
+    if (NULL != array->arena)
+    {
+        return arena_alloc(array->arena, bytes);
     }
 
+    return malloc(bytes);
+}
+
+/**
+ * @brief Checks whether the array still stores its elements inline.
+ *
+ * @param array Pointer to the array.
+ * @return `true` if `data` points at the inline buffer, `false` otherwise.
+ */
+static bool
+b_is_inline (const Array *array)
+{
+    return array->data == (const void *)array->inline_buf.bytes;
+}
+
+/**
+ * @brief Sets up an empty array that uses its inline buffer.
+ *
+ * @param array    Pointer to the array structure to set up.
+ * @param ele_type The type of elements stored in the array.
+ * @param ele_size Size of a single element in bytes.
+ * @param arena    Arena to allocate from, or NULL to use the heap.
+ */
+static void
+array_setup (Array *array, ElementType ele_type, size_t ele_size, Arena *arena)
+{
     array->idx      = 0;
     array->ele_type = ele_type;
-    array->max      = ARRAY_INITIAL_SIZE;
-    array->list     = calloc(ARRAY_INITIAL_SIZE, sizeof(void *));
+    array->ele_size = ele_size;
+    array->arena    = arena;
+    array->data     = array->inline_buf.bytes;
+    array->max      = (int)(ARRAY_INLINE_BYTES / ele_size);
+}
+
+/**
+ * @brief Allocates an array structure.
+ *
+ * The element buffer starts out inline, so no further allocation happens
+ * until the array outgrows `ARRAY_INLINE_BYTES`.
+ *
+ * @param ele_type The type of elements stored in the array.
+ * @param ele_size Size of a single element in bytes.
+ * @param arena    Arena to allocate from, or NULL to use the heap.
+ * @return Pointer to the newly created array, or NULL on failure.
+ */
+static Array *
+array_create (ElementType ele_type, size_t ele_size, Arena *arena)
+{
+    Array *array = NULL;
 
-    if (NULL == array->list)
+    if (0 == ele_size)
     {
-        ERROR_LOG("Failed calloc: unable to allocate memory");
-        free(array);
-        array = NULL;
+        ERROR_LOG("Failed element type enumeration: unsupported type");
         goto EXIT;
     }
 
-    for (int idx = 0; idx < array->max; idx++)
+    array = (NULL != arena) ? arena_alloc(arena, sizeof(Array))
+                            : malloc(sizeof(Array));
+
+    if (NULL == array)
     {
-        array->list[idx] = NULL;
+        ERROR_LOG("Failed to allocate memory for array");
+        goto EXIT;
     }
 
+    array_setup(array, ele_type, ele_size, arena);
+
 EXIT:
     return array;
 }
 
+int
+array_init (Array *array, ElementType ele_type)
+{
+    size_t ele_size = array_element_size(ele_type);
+
+    if (NULL == array)
+    {
+        ERROR_LOG("Invalid input to array_init: input is NULL");
+        return ERROR_NULL_POINTER;
+    }
+
+    if (0 == ele_size)
+    {
+        ERROR_LOG("Failed element type enumeration: unsupported type");
+        return ERROR_INVALID_INPUT;
+    }
+
+    array_setup(array, ele_type, ele_size, NULL);
+    return ERROR_SUCCESS;
+}
+
+void
+array_release (Array *array)
+{
+    if (NULL != array)
+    {
+        if ((NULL == array->arena) && (false == b_is_inline(array)))
+        {
+            free(array->data);
+        }
+
+        array_setup(array, array->ele_type, array->ele_size, array->arena);
+    }
+}
+
+Array *
+array_initialization (ElementType ele_type)
+{
+    return array_create(ele_type, array_element_size(ele_type), NULL);
+}
+
+Array *
+array_initialization_arena (ElementType ele_type, Arena *arena)
+{
+    if (NULL == arena)
+    {
+        ERROR_LOG("Invalid input to array_initialization_arena: arena is NULL");
+        return NULL;
+    }
+
+    return array_create(ele_type, array_element_size(ele_type), arena);
+}
+
+Array *
+array_initialization_custom (size_t ele_size)
+{
+    return array_create(TYPE_CUSTOM, ele_size, NULL);
+}
+
 /**
  * @brief Resizes the array to a larger capacity.
  *
- * This function reallocates memory for the array to double its size.
- * New elements are initialized to NULL.
+ * This function reallocates the element buffer to double its capacity, or
+ * to `ARRAY_INITIAL_SIZE` elements if that is larger.
  *
  * @param array Pointer to the array to be resized.
  * @return ERROR_SUCCESS on success, or an appropriate error code on failure.
  */
 static int
 array_resize (Array *array)
+{
+    if (NULL == array)
+    {
+        ERROR_LOG("Invalid input to array_resize: input is NULL");
+        return ERROR_NULL_POINTER;
+    }
+
+    int new_size = (INT_MAX / 2 < array->max) ? INT_MAX : array->max * 2;
+
+    return array_reserve(
+        array, (ARRAY_INITIAL_SIZE > new_size) ? ARRAY_INITIAL_SIZE : new_size);
+}
+
+int
+array_reserve (Array *array, int capacity)
 {
     int return_status = ERROR_NULL_POINTER;
 
     if (NULL == array)
     {
-        ERROR_LOG("Invalid input to array_resize: input is NULL");
+        ERROR_LOG("Invalid input to array_reserve: input is NULL");
         goto EXIT;
     }
 
-    int    new_size = array->max * 2;
-    void **new_list = (void **)realloc(array->list, new_size * sizeof(void *));
-
-    if (NULL == new_list)
+    if (capacity <= array->max)
     {
-        ERROR_LOG("Failed realloc: unable to allocate memory");
-        return_status = ERROR_OUT_OF_MEMORY;
+        return_status = ERROR_SUCCESS;
         goto EXIT;
     }
 
-    // Initialize new elements to NULL
-    for (int idx = array->max; idx < new_size; idx++)
+    void *new_data = NULL;
+
+    if ((NULL != array->arena) || (true == b_is_inline(array)))
+    {
+        // Arena and inline storage cannot be reallocated; copy what is stored
+        new_data = array_alloc_buffer(array, capacity);
+
+        if (NULL != new_data)
+        {
+            memcpy(new_data, array->data, (size_t)array->idx * array->ele_size);
+        }
+    }
+    else
     {
-        new_list[idx] = NULL;
+        new_data = realloc(array->data, (size_t)capacity * array->ele_size);
     }
 
-    array->max    = new_size;
-    array->list   = new_list;
+    if (NULL == new_data)
+    {
+        ERROR_LOG("Failed realloc: unable to allocate memory");
+        return_status = ERROR_OUT_OF_MEMORY;
+        goto EXIT;
+    }
+
+    array->max    = capacity;
+    array->data   = new_data;
     return_status = ERROR_SUCCESS;
 
 EXIT:
@@ -100,19 +304,16 @@ EXIT:
 void
 array_destroy (Array *array)
 {
-    if (NULL != array)
+    // Arena-backed arrays are released with their arena
+    if ((NULL != array) && (NULL == array->arena))
     {
-        if (NULL != array->list)
+        if (false == b_is_inline(array))
         {
-            for (int i = 0; i < array->idx; i++)
-            {
-                free(array->list[i]);
-            }
-
-            free(array->list);
-            array->list = NULL;
+            free(array->data);
         }
 
+        array->data = NULL;
+
         free(array);
         array = NULL;
     }
@@ -123,7 +324,7 @@ array_add (Array *array, const void *ele)
 {
     int return_status = ERROR_NULL_POINTER;
 
-    if (NULL == array)
+    if ((NULL == array) || (NULL == ele))
     {
         ERROR_LOG("Invalid input to array_add: input is NULL");
         goto EXIT;
@@ -141,50 +342,84 @@ array_add (Array *array, const void *ele)
         }
     }
 
-    size_t ele_size;
+    // Copy data into the next free slot
+    memcpy((char *)array->data + (size_t)array->idx * array->ele_size,
+           ele,
+           array->ele_size);
+    array->idx++;
+    return_status = ERROR_SUCCESS;
+
+EXIT:
+    return return_status;
+}
+
+int
+array_add_n (Array *array, const void *eles, int count)
+{
+    int return_status = ERROR_NULL_POINTER;
 
-    switch (array->ele_type)
+    if ((NULL == array) || ((NULL == eles) && (0 < count)))
     {
-        case TYPE_INT:
-            ele_size = sizeof(int);
-            break;
-        case TYPE_FLOAT:
-            ele_size = sizeof(float);
-            break;
-        case TYPE_DOUBLE:
-            ele_size = sizeof(double);
-            break;
-        case TYPE_CHAR:
-            ele_size = sizeof(char);
-            break;
-        case TYPE_INT_PTR:
-            ele_size = sizeof(int *);
-            break;
-        default:
-            ERROR_LOG("Failed element type enumeration: unsupported type");
-            return_status = ERROR_INVALID_INPUT;
-            goto EXIT;
+        ERROR_LOG("Invalid input to array_add_n: input is NULL");
+        goto EXIT;
     }
 
-    // Allocate memory for the new element and copy the data
-    array->list[array->idx] = calloc(1, ele_size);
+    if (0 > count)
+    {
+        ERROR_LOG("Invalid input to array_add_n: negative count");
+        return_status = ERROR_INVALID_INPUT;
+        goto EXIT;
+    }
 
-    if (NULL == array->list[array->idx])
+    if (count > INT_MAX - array->idx)
     {
-        ERROR_LOG("Failed calloc: unable to allocate memory");
-        return_status = ERROR_OUT_OF_MEMORY;
+        ERROR_LOG("Invalid input to array_add_n: count overflows the array");
+        return_status = ERROR_OUT_OF_RANGE;
         goto EXIT;
     }
 
-    // Copy data into the allocated space
-    memcpy(array->list[array->idx], ele, ele_size);
-    array->idx++;
+    int needed = array->idx + count;
+
+    // Grow geometrically so repeated bulk appends stay amortized O(1)
+    if (needed > array->max)
+    {
+        int capacity = (INT_MAX / 2 < array->max) ? INT_MAX : array->max * 2;
+
+        return_status = array_reserve(array, (needed > capacity) ? needed
+                                                                 : capacity);
+
+        if (ERROR_SUCCESS != return_status)
+        {
+            ERROR_LOG("Failed array_reserve: unable to allocate memory");
+            goto EXIT;
+        }
+    }
+
+    if (0 < count)
+    {
+        memcpy((char *)array->data + (size_t)array->idx * array->ele_size,
+               eles,
+               (size_t)count * array->ele_size);
+    }
+
+    array->idx    = needed;
     return_status = ERROR_SUCCESS;
 
 EXIT:
     return return_status;
 }
 
+void *
+array_get (const Array *array, int index)
+{
+    if ((NULL == array) || (0 > index) || (array->idx <= index))
+    {
+        return NULL;
+    }
+
+    return (char *)array->data + (size_t)index * array->ele_size;
+}
+
 int
 array_reset (Array *array)
 {
@@ -196,14 +431,8 @@ array_reset (Array *array)
         goto EXIT;
     }
 
-    if (NULL != array->list)
+    if (NULL != array->data)
     {
-        for (int i = 0; i < array->idx; i++)
-        {
-            free(array->list[i]);
-            array->list[i] = NULL;
-        }
-
         array->idx    = 0;
         return_status = ERROR_SUCCESS;
     }
@@ -227,7 +456,7 @@ array_copy (Array *src, Array *dst)
         goto EXIT;
     }
 
-    if (src->ele_type != dst->ele_type)
+    if ((src->ele_type != dst->ele_type) || (src->ele_size != dst->ele_size))
     {
         ERROR_LOG(
             "Invalid input to array_copy: arrays must have matching types");
@@ -244,23 +473,638 @@ array_copy (Array *src, Array *dst)
         goto EXIT;
     }
 
-    // Copy each element from src to dst using array_add
-    for (int idx = 0; idx < src->idx; idx++)
+    return_status = array_add_n(dst, src->data, src->idx);
+
+    if (ERROR_SUCCESS != return_status)
+    {
+        ERROR_LOG("Failed array_add_n: unable to copy into destination array");
+    }
+
+EXIT:
+    return return_status;
+}
+
+int
+array_swap (Array *a, Array *b)
+{
+    if ((NULL == a) || (NULL == b))
+    {
+        ERROR_LOG("Invalid input to array_swap: one or more inputs are NULL");
+        return ERROR_NULL_POINTER;
+    }
+
+    if (a->arena != b->arena)
     {
-        return_status = array_add(dst, src->list[idx]);
+        ERROR_LOG("Invalid input to array_swap: arrays have different owners");
+        return ERROR_INVALID_INPUT;
+    }
 
-        if (ERROR_SUCCESS != return_status)
+    bool  b_a_inline = b_is_inline(a);
+    bool  b_b_inline = b_is_inline(b);
+    Array temp       = *a;
+
+    *a = *b;
+    *b = temp;
+
+    // Inline buffers travel with the structure; repoint them at their new home
+    if (true == b_a_inline)
+    {
+        b->data = b->inline_buf.bytes;
+    }
+
+    if (true == b_b_inline)
+    {
+        a->data = a->inline_buf.bytes;
+    }
+
+    return ERROR_SUCCESS;
+}
+
+int
+array_move (Array *dst, Array *src)
+{
+    if ((NULL == dst) || (NULL == src))
+    {
+        ERROR_LOG("Invalid input to array_move: one or more inputs are NULL");
+        return ERROR_NULL_POINTER;
+    }
+
+    if (dst->arena != src->arena)
+    {
+        ERROR_LOG("Invalid input to array_move: arrays have different owners");
+        return ERROR_INVALID_INPUT;
+    }
+
+    if (dst == src)
+    {
+        return ERROR_SUCCESS;
+    }
+
+    array_release(dst);
+
+    bool b_src_inline = b_is_inline(src);
+
+    *dst = *src;
+
+    if (true == b_src_inline)
+    {
+        dst->data = dst->inline_buf.bytes;
+    }
+
+    // The buffer now belongs to dst; leave src empty without freeing it
+    array_setup(src, src->ele_type, src->ele_size, src->arena);
+    return ERROR_SUCCESS;
+}
+
+ArrayView
+array_view (const Array *array)
+{
+    if (NULL == array)
+    {
+        return array_view_buffer(NULL, 0, 0);
+    }
+
+    return array_view_buffer(array->data, array->idx, array->ele_size);
+}
+
+ArrayView
+array_view_buffer (const void *data, int len, size_t ele_size)
+{
+    ArrayView view = { NULL, 0, 0, -1 };
+
+    if ((NULL != data) && (0 < len))
+    {
+        view.data   = data;
+        view.len    = len;
+        view.stride = (ptrdiff_t)ele_size;
+    }
+
+    return view;
+}
+
+ArrayView
+array_view_slice (ArrayView view, int start, int len)
+{
+    if (0 > start)
+    {
+        len += start;
+        start = 0;
+    }
+
+    if (start > view.len)
+    {
+        start = view.len;
+    }
+
+    if ((0 > len) || (len > view.len - start))
+    {
+        len = (0 > len) ? 0 : view.len - start;
+    }
+
+    view.data += start * view.stride;
+    view.len = len;
+
+    if ((view.skip < start) || (view.skip >= start + len))
+    {
+        view.skip = -1;
+    }
+    else
+    {
+        view.skip -= start;
+    }
+
+    return view;
+}
+
+ArrayView
+array_view_without (ArrayView view, int index)
+{
+    view.skip = ((0 <= index) && (index < view.len)) ? index : -1;
+    return view;
+}
+
+/**
+ * @brief Sorts integers ascending with an LSD radix sort.
+ *
+ * Integers are sorted one byte at a time, least significant first, with the
+ * sign bit flipped so negative values order before positive ones. Passes in
+ * which every key shares the same byte are skipped. The sort is stable, and
+ * `payload` (if not NULL) is permuted alongside `values`.
+ *
+ * @param values  Pointer to the integers to be sorted.
+ * @param payload Pointer to integers permuted with `values`, or NULL.
+ * @param count   Number of integers.
+ * @return ERROR_SUCCESS on success, or an appropriate error code on failure.
+ */
+static int
+radix_sort_int (int *values, int *payload, int count)
+{
+    int           return_status = ERROR_OUT_OF_MEMORY;
+    unsigned int *keys          = (unsigned int *)values;
+    unsigned int *key_tmp       = malloc((size_t)count * sizeof(unsigned int));
+    int          *payload_tmp   = NULL;
+    size_t        counts[RADIX_PASSES][RADIX_BUCKETS];
+
+    if (NULL != payload)
+    {
+        payload_tmp = malloc((size_t)count * sizeof(int));
+    }
+
+    if ((NULL == key_tmp) || ((NULL != payload) && (NULL == payload_tmp)))
+    {
+        ERROR_LOG("Failed malloc: unable to allocate memory");
+        goto EXIT;
+    }
+
+    // Flip the sign bit and histogram every byte in a single pass
+    memset(counts, 0, sizeof(counts));
+
+    for (int idx = 0; idx < count; idx++)
+    {
+        keys[idx] ^= RADIX_SIGN_BIT;
+
+        for (int pass = 0; pass < RADIX_PASSES; pass++)
         {
-            ERROR_LOG(
-                "Failed array_add: unable to add element to destination array");
-            break;
+            counts[pass][(keys[idx] >> (pass * RADIX_BITS))
+                         & (RADIX_BUCKETS - 1)]++;
+        }
+    }
+
+    unsigned int *src_keys    = keys;
+    unsigned int *dst_keys    = key_tmp;
+    int          *src_payload = payload;
+    int          *dst_payload = payload_tmp;
+
+    for (int pass = 0; pass < RADIX_PASSES; pass++)
+    {
+        int     shift      = pass * RADIX_BITS;
+        size_t *count_pass = counts[pass];
+
+        // Every key has the same digit here, so the order is unchanged
+        if ((size_t)count
+            == count_pass[(src_keys[0] >> shift) & (RADIX_BUCKETS - 1)])
+        {
+            continue;
+        }
+
+        size_t offset = 0;
+
+        for (int bucket = 0; bucket < RADIX_BUCKETS; bucket++)
+        {
+            size_t bucket_count = count_pass[bucket];
+            count_pass[bucket]  = offset;
+            offset += bucket_count;
+        }
+
+        for (int idx = 0; idx < count; idx++)
+        {
+            size_t dst = count_pass[(src_keys[idx] >> shift)
+                                    & (RADIX_BUCKETS - 1)]++;
+            dst_keys[dst] = src_keys[idx];
+
+            if (NULL != src_payload)
+            {
+                dst_payload[dst] = src_payload[idx];
+            }
+        }
+
+        unsigned int *swap_keys    = src_keys;
+        int          *swap_payload = src_payload;
+        src_keys                   = dst_keys;
+        dst_keys                   = swap_keys;
+        src_payload                = dst_payload;
+        dst_payload                = swap_payload;
+    }
+
+    // An odd number of passes leaves the result in the scratch buffers
+    if (src_keys != keys)
+    {
+        memcpy(keys, src_keys, (size_t)count * sizeof(unsigned int));
+
+        if (NULL != payload)
+        {
+            memcpy(payload, src_payload, (size_t)count * sizeof(int));
+        }
+    }
+
+    for (int idx = 0; idx < count; idx++)
+    {
+        keys[idx] ^= RADIX_SIGN_BIT;
+    }
+
+    return_status = ERROR_SUCCESS;
+
+EXIT:
+    free(key_tmp);
+    free(payload_tmp);
+    return return_status;
+}
+
+/**
+ * @brief Adapts a plain comparator, passed as context, to `ArrayCompareCtx`.
+ *
+ * @param lhs Pointer to the left element.
+ * @param rhs Pointer to the right element.
+ * @param ctx Pointer to the `ArrayCompare` to call.
+ * @return The result of the wrapped comparator.
+ */
+static int
+compare_plain (const void *lhs, const void *rhs, void *ctx)
+{
+    const ArrayCompare *compare = ctx;
+
+    return (*compare)(lhs, rhs);
+}
+
+/**
+ * @brief Sorts the elements of an array with a stable bottom-up merge sort.
+ *
+ * Arrays of at most `ARRAY_SORT_STACK_BYTES` bytes merge through a stack
+ * buffer, so sorting them never allocates.
+ *
+ * @param array   Pointer to the array to be sorted.
+ * @param compare Comparison function ordering the elements.
+ * @param ctx     Context passed to `compare`.
+ * @return ERROR_SUCCESS on success, or an appropriate error code on failure.
+ */
+static int
+merge_sort (Array *array, ArrayCompareCtx compare, void *ctx)
+{
+    size_t ele_size = array->ele_size;
+    int    count    = array->idx;
+    size_t bytes    = (size_t)count * ele_size;
+    char   stack_buf[ARRAY_SORT_STACK_BYTES];
+    char  *scratch = (ARRAY_SORT_STACK_BYTES >= bytes) ? stack_buf
+                                                        : malloc(bytes);
+
+    if (NULL == scratch)
+    {
+        ERROR_LOG("Failed malloc: unable to allocate memory");
+        return ERROR_OUT_OF_MEMORY;
+    }
+
+    char *src = array->data;
+    char *dst = scratch;
+
+    for (int width = 1; width < count; width *= 2)
+    {
+        for (int lo = 0; lo < count; lo += 2 * width)
+        {
+            int mid   = (lo + width < count) ? lo + width : count;
+            int hi    = (lo + 2 * width < count) ? lo + 2 * width : count;
+            int left  = lo;
+            int right = mid;
+            int out   = lo;
+
+            // Take from the left run unless the right element is smaller
+            while ((left < mid) && (right < hi))
+            {
+                if (0 > compare(
+                        src + right * ele_size, src + left * ele_size, ctx))
+                {
+                    memcpy(dst + out++ * ele_size,
+                           src + right++ * ele_size,
+                           ele_size);
+                }
+                else
+                {
+                    memcpy(dst + out++ * ele_size,
+                           src + left++ * ele_size,
+                           ele_size);
+                }
+            }
+
+            memcpy(dst + out * ele_size,
+                   src + left * ele_size,
+                   (size_t)(mid - left) * ele_size);
+            out += mid - left;
+            memcpy(dst + out * ele_size,
+                   src + right * ele_size,
+                   (size_t)(hi - right) * ele_size);
         }
+
+        char *swap = src;
+        src        = dst;
+        dst        = swap;
+    }
+
+    if (src != array->data)
+    {
+        memcpy(array->data, src, (size_t)count * ele_size);
+    }
+
+    if (stack_buf != scratch)
+    {
+        free(scratch);
+    }
+
+    return ERROR_SUCCESS;
+}
+
+int
+array_sort (Array *array, ArrayCompare compare)
+{
+    if (NULL == array)
+    {
+        ERROR_LOG("Invalid input to array_sort: input is NULL");
+        return ERROR_NULL_POINTER;
+    }
+
+    if (NULL == compare)
+    {
+        return array_sort_stable(array, compare);
+    }
+
+    qsort(array->data, (size_t)array->idx, array->ele_size, compare);
+    return ERROR_SUCCESS;
+}
+
+int
+array_sort_stable (Array *array, ArrayCompare compare)
+{
+    if (NULL == array)
+    {
+        ERROR_LOG("Invalid input to array_sort_stable: input is NULL");
+        return ERROR_NULL_POINTER;
+    }
+
+    if ((NULL == compare) && (TYPE_INT != array->ele_type))
+    {
+        ERROR_LOG(
+            "Invalid input to array_sort_stable: comparator required for "
+            "non-integer arrays");
+        return ERROR_INVALID_INPUT;
     }
 
+    if (2 > array->idx)
+    {
+        return ERROR_SUCCESS;
+    }
+
+    if (NULL == compare)
+    {
+        return radix_sort_int((int *)array->data, NULL, array->idx);
+    }
+
+    return merge_sort(array, compare_plain, &compare);
+}
+
+int
+array_sort_stable_ctx (Array *array, ArrayCompareCtx compare, void *ctx)
+{
+    if ((NULL == array) || (NULL == compare))
+    {
+        ERROR_LOG(
+            "Invalid input to array_sort_stable_ctx: one or more inputs are "
+            "NULL");
+        return ERROR_NULL_POINTER;
+    }
+
+    if (2 > array->idx)
+    {
+        return ERROR_SUCCESS;
+    }
+
+    return merge_sort(array, compare, ctx);
+}
+
+int
+array_argsort (const Array *keys, Array *indices)
+{
+    int  return_status = ERROR_NULL_POINTER;
+    int *key_copy      = NULL;
+
+    if ((NULL == keys) || (NULL == indices))
+    {
+        ERROR_LOG(
+            "Invalid input to array_argsort: one or more inputs are NULL");
+        goto EXIT;
+    }
+
+    if ((TYPE_INT != keys->ele_type) || (TYPE_INT != indices->ele_type))
+    {
+        ERROR_LOG("Invalid input to array_argsort: arrays must be TYPE_INT");
+        return_status = ERROR_INVALID_INPUT;
+        goto EXIT;
+    }
+
+    return_status = array_reset(indices);
+
+    if (ERROR_SUCCESS == return_status)
+    {
+        return_status = array_reserve(indices, keys->idx);
+    }
+
+    if (ERROR_SUCCESS != return_status)
+    {
+        ERROR_LOG("Failed array_reserve: unable to size index array");
+        goto EXIT;
+    }
+
+    for (int idx = 0; idx < keys->idx; idx++)
+    {
+        ARRAY_AT(indices, int, idx) = idx;
+    }
+
+    indices->idx = keys->idx;
+
+    if (2 > keys->idx)
+    {
+        goto EXIT;
+    }
+
+    // Sort a copy of the keys, carrying the positions along as payload
+    key_copy = malloc((size_t)keys->idx * sizeof(int));
+
+    if (NULL == key_copy)
+    {
+        ERROR_LOG("Failed malloc: unable to allocate memory");
+        return_status = ERROR_OUT_OF_MEMORY;
+        goto EXIT;
+    }
+
+    memcpy(key_copy, keys->data, (size_t)keys->idx * sizeof(int));
+    return_status = radix_sort_int(key_copy, (int *)indices->data, keys->idx);
+
 EXIT:
+    free(key_copy);
     return return_status;
 }
 
+/**
+ * @brief Branchless lower bound over a sorted int buffer.
+ *
+ * The search window halves every iteration and the comparison only picks
+ * which half to keep, which compiles to a conditional move rather than an
+ * unpredictable branch.
+ *
+ * @param values Pointer to the sorted values.
+ * @param count  Number of values.
+ * @param key    Key to search for.
+ * @return Index of the first value `>= key`, or `count` if there is none.
+ */
+static int
+lower_bound_int (const int *values, int count, int key)
+{
+    const int *base = values;
+    int        len  = count;
+
+    if (0 >= len)
+    {
+        return 0;
+    }
+
+    while (1 < len)
+    {
+        int half = len / 2;
+
+        base = (base[half] < key) ? base + half : base;
+        len -= half;
+    }
+
+    return (int)(base - values) + (*base < key);
+}
+
+/**
+ * @brief Shared implementation of the lower and upper bound searches.
+ *
+ * @param array   Pointer to the sorted array.
+ * @param key     Pointer to the key to search for.
+ * @param compare Comparison function, or NULL for ascending `TYPE_INT`.
+ * @param b_upper Whether to find the upper rather than the lower bound.
+ * @return The bound's index, or a negative error code on failure.
+ */
+static int
+array_bound (const Array *array,
+             const void  *key,
+             ArrayCompare compare,
+             bool         b_upper)
+{
+    if ((NULL == array) || (NULL == key))
+    {
+        ERROR_LOG("Invalid input to array bound: one or more inputs are NULL");
+        return ERROR_NULL_POINTER;
+    }
+
+    if (NULL == compare)
+    {
+        if (TYPE_INT != array->ele_type)
+        {
+            ERROR_LOG("Invalid input to array bound: compare is required");
+            return ERROR_INVALID_INPUT;
+        }
+
+        int value = *(const int *)key;
+
+        // The upper bound of an int is the lower bound of its successor
+        if (true == b_upper)
+        {
+            return (INT_MAX == value)
+                       ? array->idx
+                       : lower_bound_int(array->data, array->idx, value + 1);
+        }
+
+        return lower_bound_int(array->data, array->idx, value);
+    }
+
+    const char *data = array->data;
+    int         low  = 0;
+    int         high = array->idx;
+
+    while (low < high)
+    {
+        int mid   = low + (high - low) / 2;
+        int order = compare(data + (size_t)mid * array->ele_size, key);
+
+        if ((0 > order) || ((true == b_upper) && (0 == order)))
+        {
+            low = mid + 1;
+        }
+        else
+        {
+            high = mid;
+        }
+    }
+
+    return low;
+}
+
+int
+array_lower_bound (const Array *array, const void *key, ArrayCompare compare)
+{
+    return array_bound(array, key, compare, false);
+}
+
+int
+array_upper_bound (const Array *array, const void *key, ArrayCompare compare)
+{
+    return array_bound(array, key, compare, true);
+}
+
+int
+array_equal_range (const Array *array,
+                   const void  *key,
+                   ArrayCompare compare,
+                   int          range[2])
+{
+    if (NULL == range)
+    {
+        ERROR_LOG("Invalid input to array_equal_range: range is NULL");
+        return ERROR_NULL_POINTER;
+    }
+
+    int start = array_bound(array, key, compare, false);
+
+    if (0 > start)
+    {
+        return start;
+    }
+
+    range[0] = start;
+    range[1] = array_bound(array, key, compare, true);
+    return ERROR_SUCCESS;
+}
+
 void
 array_print (Array *array)
 {
@@ -270,7 +1114,7 @@ array_print (Array *array)
         return;
     }
 
-    if (NULL == array->list)
+    if (NULL == array->data)
     {
         ERROR_LOG("Invalid input to array_print: input is NULL");
         return;
@@ -278,33 +1122,29 @@ array_print (Array *array)
 
     for (int idx = 0; idx < array->idx; idx++)
     {
-        if (NULL == array->list[idx])
+        switch (array->ele_type)
         {
-            printf("[NULL]");
-        }
-        else
-        {
-            switch (array->ele_type)
-            {
-                case TYPE_INT:
-                    printf("%d", *(int *)array->list[idx]);
-                    break;
-                case TYPE_FLOAT:
-                    printf("%f", *(float *)array->list[idx]);
-                    break;
-                case TYPE_DOUBLE:
-                    printf("%lf", *(double *)array->list[idx]);
-                    break;
-                case TYPE_CHAR:
-                    printf("%c", *(char *)array->list[idx]);
-                    break;
-                case TYPE_INT_PTR:
-                    printf("[POINTER TYPE]");
-                    break;
-                default:
-                    printf("[UNKNOWN TYPE]");
-                    break;
-            }
+            case TYPE_INT:
+                printf("%d", ARRAY_AT(array, int, idx));
+                break;
+            case TYPE_FLOAT:
+                printf("%f", ARRAY_AT(array, float, idx));
+                break;
+            case TYPE_DOUBLE:
+                printf("%lf", ARRAY_AT(array, double, idx));
+                break;
+            case TYPE_CHAR:
+                printf("%c", ARRAY_AT(array, char, idx));
+                break;
+            case TYPE_INT_PTR:
+                printf("[POINTER TYPE]");
+                break;
+            case TYPE_CUSTOM:
+                printf("[CUSTOM TYPE]");
+                break;
+            default:
+                printf("[UNKNOWN TYPE]");
+                break;
         }
 
         if (idx < array->idx - 1)
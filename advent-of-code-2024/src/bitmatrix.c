@@ -0,0 +1,177 @@
+#include "aux.h"
+#include "bitmatrix.h"
+#include "error.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+/**
+ * @file bitmatrix.c
+ * @brief Bit matrix functions.
+ *
+ * This file contains functions handle all bit matrix functions.
+ */
+
+/* Function Prototypes */
+static bool b_in_bounds(const BitMatrix *matrix, int row, int col);
+
+/**
+ * @brief Checks that a matrix is valid and a position lies inside it.
+ *
+ * @param matrix Pointer to the bit matrix.
+ * @param row    Row index.
+ * @param col    Column index.
+ * @return `true` if the position can be accessed, `false` otherwise.
+ */
+static bool
+b_in_bounds (const BitMatrix *matrix, int row, int col)
+{
+    return (NULL != matrix) && (0 <= row) && (matrix->num_rows > row)
+           && (0 <= col) && (matrix->num_cols > col);
+}
+
+BitMatrix *
+bitmatrix_initialization (int num_rows, int num_cols)
+{
+    BitMatrix *matrix = NULL;
+
+    if ((0 > num_rows) || (0 > num_cols))
+    {
+        ERROR_LOG(
+            "Invalid input to bitmatrix_initialization: negative dimension");
+        goto EXIT;
+    }
+
+    matrix = malloc(sizeof(BitMatrix));
+
+    if (NULL == matrix)
+    {
+        ERROR_LOG("Failed malloc: unable to allocate memory");
+        goto EXIT;
+    }
+
+    matrix->num_rows      = num_rows;
+    matrix->num_cols      = num_cols;
+    matrix->words_per_row
+        = (num_cols + BITMATRIX_WORD_BITS - 1) / BITMATRIX_WORD_BITS;
+
+    // Always allocate at least one word so an empty matrix is still valid
+    size_t num_words = (size_t)num_rows * matrix->words_per_row;
+    matrix->capacity = (0 < num_words) ? num_words : 1;
+    matrix->words    = calloc(matrix->capacity, sizeof(uint64_t));
+
+    if (NULL == matrix->words)
+    {
+        ERROR_LOG("Failed calloc: unable to allocate memory");
+        free(matrix);
+        matrix = NULL;
+    }
+
+EXIT:
+    return matrix;
+}
+
+void
+bitmatrix_destroy (BitMatrix *matrix)
+{
+    if (NULL != matrix)
+    {
+        free(matrix->words);
+        matrix->words = NULL;
+
+        free(matrix);
+        matrix = NULL;
+    }
+}
+
+int
+bitmatrix_set (BitMatrix *matrix, int row, int col)
+{
+    if (false == b_in_bounds(matrix, row, col))
+    {
+        ERROR_LOG("Invalid input to bitmatrix_set: position out of bounds");
+        return (NULL == matrix) ? ERROR_NULL_POINTER
+                                : ERROR_INDEX_OUT_OF_BOUNDS;
+    }
+
+    matrix->words[(size_t)row * matrix->words_per_row
+                  + col / BITMATRIX_WORD_BITS]
+        |= (uint64_t)1 << (col % BITMATRIX_WORD_BITS);
+    return ERROR_SUCCESS;
+}
+
+int
+bitmatrix_clear (BitMatrix *matrix, int row, int col)
+{
+    if (false == b_in_bounds(matrix, row, col))
+    {
+        ERROR_LOG("Invalid input to bitmatrix_clear: position out of bounds");
+        return (NULL == matrix) ? ERROR_NULL_POINTER
+                                : ERROR_INDEX_OUT_OF_BOUNDS;
+    }
+
+    matrix->words[(size_t)row * matrix->words_per_row
+                  + col / BITMATRIX_WORD_BITS]
+        &= ~((uint64_t)1 << (col % BITMATRIX_WORD_BITS));
+    return ERROR_SUCCESS;
+}
+
+bool
+bitmatrix_test (const BitMatrix *matrix, int row, int col)
+{
+    return b_in_bounds(matrix, row, col) && BITMATRIX_TEST(matrix, row, col);
+}
+
+void
+bitmatrix_reset (BitMatrix *matrix)
+{
+    if (NULL != matrix)
+    {
+        memset(matrix->words,
+               0,
+               (size_t)matrix->num_rows * matrix->words_per_row
+                   * sizeof(uint64_t));
+    }
+}
+
+int
+bitmatrix_resize (BitMatrix *matrix, int num_rows, int num_cols)
+{
+    if (NULL == matrix)
+    {
+        ERROR_LOG("Invalid input to bitmatrix_resize: input is NULL");
+        return ERROR_NULL_POINTER;
+    }
+
+    if ((0 > num_rows) || (0 > num_cols))
+    {
+        ERROR_LOG("Invalid input to bitmatrix_resize: negative dimension");
+        return ERROR_INVALID_INPUT;
+    }
+
+    int words_per_row
+        = (num_cols + BITMATRIX_WORD_BITS - 1) / BITMATRIX_WORD_BITS;
+    size_t num_words = (size_t)num_rows * words_per_row;
+
+    if (num_words > matrix->capacity)
+    {
+        uint64_t *words = realloc(matrix->words, num_words * sizeof(uint64_t));
+
+        if (NULL == words)
+        {
+            ERROR_LOG("Failed realloc: unable to allocate memory");
+            return ERROR_OUT_OF_MEMORY;
+        }
+
+        matrix->words    = words;
+        matrix->capacity = num_words;
+    }
+
+    matrix->num_rows      = num_rows;
+    matrix->num_cols      = num_cols;
+    matrix->words_per_row = words_per_row;
+    bitmatrix_reset(matrix);
+    return ERROR_SUCCESS;
+}
+
+/*** end of file ***/
@@ -0,0 +1,151 @@
+#include "cursor.h"
+#include "error.h"
+#include "parse.h"
+
+#include <string.h>
+
+/**
+ * @file cursor.c
+ * @brief Text cursor functions.
+ *
+ * This file contains functions handle all text cursor functions. Every scan
+ * is bounded by the cursor's end pointer rather than a terminator, line and
+ * field searches use `memchr`, which the C library vectorizes, and integers
+ * go through the SWAR parser of `parse_int`.
+ */
+
+/* Function Prototypes */
+static bool b_is_blank(char ch);
+
+/**
+ * @brief Checks whether a character is skipped as whitespace.
+ *
+ * @param ch Character to check.
+ * @return `true` for a space, tab, carriage return or newline.
+ */
+static bool
+b_is_blank (char ch)
+{
+    return (' ' == ch) || ('\t' == ch) || ('\r' == ch) || ('\n' == ch);
+}
+
+Cursor
+cursor_initialization (const char *data, size_t len)
+{
+    Cursor cursor = { data, (NULL != data) ? data + len : data };
+
+    return cursor;
+}
+
+Cursor
+cursor_from_span (Span span)
+{
+    return cursor_initialization(span.data, span.len);
+}
+
+bool
+cursor_at_end (const Cursor *cursor)
+{
+    return (NULL == cursor) || (cursor->pos >= cursor->end);
+}
+
+void
+cursor_skip_whitespace (Cursor *cursor)
+{
+    if (NULL == cursor)
+    {
+        return;
+    }
+
+    while ((cursor->pos < cursor->end) && (b_is_blank(*cursor->pos)))
+    {
+        cursor->pos++;
+    }
+}
+
+bool
+cursor_next_line (Cursor *cursor, Span *line)
+{
+    if ((true == cursor_at_end(cursor)) || (NULL == line))
+    {
+        return false;
+    }
+
+    size_t      left = (size_t)(cursor->end - cursor->pos);
+    const char *stop = memchr(cursor->pos, '\n', left);
+    size_t      len  = (NULL != stop) ? (size_t)(stop - cursor->pos) : left;
+
+    line->data = cursor->pos;
+    cursor->pos += (NULL != stop) ? len + 1 : len;
+
+    if ((0 < len) && ('\r' == line->data[len - 1]))
+    {
+        len--;
+    }
+
+    line->len = len;
+    return true;
+}
+
+bool
+cursor_next_field (Cursor *cursor, char delimiter, Span *field)
+{
+    if ((true == cursor_at_end(cursor)) || (NULL == field))
+    {
+        return false;
+    }
+
+    size_t      left = (size_t)(cursor->end - cursor->pos);
+    const char *stop = memchr(cursor->pos, delimiter, left);
+    size_t      len  = (NULL != stop) ? (size_t)(stop - cursor->pos) : left;
+
+    field->data = cursor->pos;
+    field->len  = len;
+    cursor->pos += (NULL != stop) ? len + 1 : len;
+    return true;
+}
+
+bool
+cursor_next_int (Cursor *cursor, int *value)
+{
+    if ((NULL == cursor) || (NULL == value))
+    {
+        return false;
+    }
+
+    cursor_skip_whitespace(cursor);
+
+    const char *next   = NULL;
+    int         number = 0;
+
+    if (ERROR_SUCCESS != parse_int(cursor->pos, cursor->end, &number, &next))
+    {
+        return false;
+    }
+
+    *value      = number;
+    cursor->pos = next;
+    return true;
+}
+
+bool
+cursor_match (Cursor *cursor, const char *literal)
+{
+    if ((NULL == cursor) || (NULL == literal))
+    {
+        return false;
+    }
+
+    size_t len = strlen(literal);
+
+    if (((size_t)(cursor->end - cursor->pos) < len)
+        || (0 != memcmp(cursor->pos, literal, len)))
+    {
+        return false;
+    }
+
+    cursor->pos += len;
+    return true;
+}
+
+/*** end of file ***/
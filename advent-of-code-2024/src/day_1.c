@@ -1,9 +1,16 @@
+#include "arena.h"
 #include "array.h"
 #include "aux.h"
+#include "cursor.h"
 #include "day_1.h"
 #include "error.h"
+#include "histogram.h"
+#include "input.h"
+#include "kernel.h"
+#include "parallel.h"
+#include "parse.h"
 
-#include <stdio.h>
+#include <limits.h>
 #include <stdlib.h>
 #include <string.h>
 
@@ -13,17 +20,26 @@
  */
 
 /* Function Prototypes */
-static int similarity_score(int num, void **array, int size);
-static int extract_digits(const char *line, int digits[2]);
-void       bubble_sort(Array *array);
+static long long distance_chunk(const Array *array,
+                                int          start,
+                                int          end,
+                                void        *ctx);
+static int extract_digits(Span        line,
+                          const char *p_end,
+                          int         width,
+                          int         digits[2]);
+static int count_lines(const Input *p_input);
+static int id_width(const Input *p_input);
 
 int
 day_1 (const char *filename, int result[2])
 {
-    int    return_status = ERROR_UNKNOWN;
-    Array *array_one     = NULL;
-    Array *array_two     = NULL;
-    FILE  *fptr          = NULL;
+    int        return_status = ERROR_UNKNOWN;
+    Arena     *p_arena       = NULL;
+    Array     *array_one     = NULL;
+    Array     *array_two     = NULL;
+    Histogram *p_counts      = NULL;
+    Input     *p_input       = NULL;
 
     if ((NULL == filename) || (NULL == result))
     {
@@ -32,40 +48,56 @@ day_1 (const char *filename, int result[2])
         goto EXIT;
     }
 
-    fptr = fopen(filename, "r");
+    p_input = input_open(filename);
 
-    if (NULL == fptr)
+    if (NULL == p_input)
     {
-        ERROR_LOG("Failed fopen: file not found");
+        ERROR_LOG("Failed input_open: file not found");
         return_status = ERROR_FILE_NOT_FOUND;
         goto EXIT;
     }
 
-    array_one = array_initialization(TYPE_INT);
+    // All scratch data for the day lives in one arena
+    p_arena = arena_initialization(0);
 
-    if (NULL == array_one)
+    if (NULL == p_arena)
     {
-        ERROR_LOG("Failed array_initialization: unable to allocate memory");
+        ERROR_LOG("Failed arena_initialization: unable to allocate memory");
         return_status = ERROR_OUT_OF_MEMORY;
         goto EXIT;
     }
 
-    array_two = array_initialization(TYPE_INT);
+    array_one = array_initialization_arena(TYPE_INT, p_arena);
+    array_two = array_initialization_arena(TYPE_INT, p_arena);
 
-    if (NULL == array_two)
+    if ((NULL == array_one) || (NULL == array_two))
     {
         ERROR_LOG("Failed array_initialization: unable to allocate memory");
         return_status = ERROR_OUT_OF_MEMORY;
         goto EXIT;
     }
 
-    char line[BUFFER_SIZE] = { 0 };
+    // Size both lists up front so loading never reallocates
+    int line_hint = count_lines(p_input);
+
+    if ((ERROR_SUCCESS != array_reserve(array_one, line_hint))
+        || (ERROR_SUCCESS != array_reserve(array_two, line_hint)))
+    {
+        ERROR_LOG("Failed array_reserve: unable to allocate memory");
+        return_status = ERROR_OUT_OF_MEMORY;
+        goto EXIT;
+    }
+
+    const char *p_end = p_input->data + p_input->size;
+    int         width = id_width(p_input);
+    Cursor      lines = cursor_initialization(p_input->data, p_input->size);
+    Span        line;
 
-    while (NULL != fgets(line, sizeof(line), fptr))
+    while (true == cursor_next_line(&lines, &line))
     {
         int digits[2] = { ERROR_ELEMENT_NOT_FOUND, ERROR_ELEMENT_NOT_FOUND };
 
-        if (ERROR_SUCCESS == extract_digits(line, digits))
+        if (ERROR_SUCCESS == extract_digits(line, p_end, width, digits))
         {
             array_add(array_one, &digits[0]);
             array_add(array_two, &digits[1]);
@@ -78,133 +110,178 @@ day_1 (const char *filename, int result[2])
     }
 
     // Part 1: Compute sum of absolute differences
-    bubble_sort(array_one);
-    bubble_sort(array_two);
+    if ((ERROR_SUCCESS != array_sort(array_one, NULL))
+        || (ERROR_SUCCESS != array_sort(array_two, NULL)))
+    {
+        ERROR_LOG("Failed array_sort: unable to sort location lists");
+        return_status = ERROR_OUT_OF_MEMORY;
+        goto EXIT;
+    }
 
-    int sum = 0;
+    long long distance = 0;
 
-    for (int idx = 0; idx < array_one->idx; idx++)
+    if (ERROR_SUCCESS
+        != array_parallel_reduce(
+            array_one, distance_chunk, NULL, array_two, &distance))
     {
-        sum += abs(*(int *)array_one->list[idx] - *(int *)array_two->list[idx]);
+        ERROR_LOG("Failed array_parallel_reduce: unable to sum distances");
+        goto EXIT;
     }
 
-    result[0] = sum;
+    result[0] = (int)distance;
 
-    // Part 2: Compute similarity scores
-    sum = 0;
+    // Part 2: Compute similarity scores from right-hand list frequencies
+    p_counts = array_histogram(array_two);
+
+    if (NULL == p_counts)
+    {
+        ERROR_LOG("Failed array_histogram: unable to count locations");
+        return_status = ERROR_OUT_OF_MEMORY;
+        goto EXIT;
+    }
+
+    int sum = 0;
 
     for (int idx = 0; idx < array_one->idx; idx++)
     {
-        sum += similarity_score(
-            *(int *)array_one->list[idx], array_two->list, array_two->idx);
+        int num = ARRAY_AT(array_one, int, idx);
+        sum += num * histogram_count(p_counts, num);
     }
 
     result[1]     = sum;
     return_status = ERROR_SUCCESS;
 
 EXIT:
-    if (NULL != fptr)
-    {
-        fclose(fptr);
-        fptr = NULL;
-    }
-
-    array_destroy(array_one);
-    array_destroy(array_two);
+    input_close(p_input);
+    histogram_destroy(p_counts);
+    arena_destroy(p_arena);
     return return_status;
 }
 
 /**
- * @brief Sorts an array of integers in ascending order using bubble sort.
+ * @brief Counts the lines of an input.
+ *
+ * Newlines are found with `memchr`, which is cheap next to parsing the
+ * lines, and give an exact upper bound on the number of pairs whatever the
+ * length of the first line, so the lists can be sized once.
  *
- * @param numbers Pointer to the array of integers.
- * @param size Number of elements in the array.
+ * @param p_input Loaded input to inspect.
+ * @return The line count, or 0 if it is empty or does not fit in an `int`.
  */
-void
-bubble_sort (Array *array)
+static int
+count_lines (const Input *p_input)
 {
-    if ((NULL == array) || (NULL == array->list) || (0 >= array->idx))
+    if ((NULL == p_input) || (0 == p_input->size))
     {
-        ERROR_LOG("Invalid input to bubble_sort: one or more inputs are NULL.");
-        return;
+        return 0;
     }
 
-    // Perform bubble sort on the array
-    for (int i = array->idx - 1; i > 0; i--)
+    const char *end   = p_input->data + p_input->size;
+    const char *pos   = memchr(p_input->data, '\n', p_input->size);
+    long long   count = ('\n' != end[-1]) ? 1 : 0;
+
+    while (NULL != pos)
     {
-        for (int j = 0; j < i; j++)
-        {
-            if (*(int *)array->list[j] > *(int *)array->list[j + 1])
-            {
-                void *tmp          = array->list[j];
-                array->list[j]     = array->list[j + 1];
-                array->list[j + 1] = tmp;
-            }
-        }
+        count++;
+        pos++;
+        pos = memchr(pos, '\n', (size_t)(end - pos));
     }
+
+    return (INT_MAX < count) ? 0 : (int)count;
 }
 
 /**
- * @brief Calculates a similarity score for a given integer.
+ * @brief Sums the distances between a chunk of the two sorted lists.
  *
- * The similarity score is the product of the integer and its frequency
- * in the array. The array must be sorted and contain only valid integers.
+ * @param array Left-hand list.
+ * @param start Index of the first pair of the chunk.
+ * @param end   Index one past the last pair of the chunk.
+ * @param ctx   Right-hand list, as an `Array`.
+ * @return The sum of absolute differences over the chunk.
+ */
+static long long
+distance_chunk (const Array *array, int start, int end, void *ctx)
+{
+    const Array *other = ctx;
+
+    return kernel_sad_int((const int *)array->data + start,
+                          (const int *)other->data + start,
+                          end - start);
+}
+
+/**
+ * @brief Measures the number of digits in the first location id.
  *
- * @param num The integer for which the similarity score is calculated.
- * @param array Pointer to a sorted void array filled with integers.
- * @param size The size of the array.
- * @return The similarity score if successful, or 0 on invalid input.
+ * @param p_input Loaded input to inspect.
+ * @return The width of the first id, or 0 if it is too wide to be parsed as
+ * a fixed-width `int`.
  */
 static int
-similarity_score (int num, void **array, int size)
+id_width (const Input *p_input)
 {
-    if ((0 > num) || (NULL == array) || (0 >= size))
+    const char *end   = p_input->data + p_input->size;
+    const char *next  = NULL;
+    long        value = 0;
+
+    if (ERROR_SUCCESS != parse_long(p_input->data, end, &value, &next))
     {
         return 0;
     }
 
-    int count = 0;
-
-    for (int idx = 0; idx < size; idx++)
-    {
-        if (ERROR_ELEMENT_NOT_FOUND == *(int *)array[idx])
-        {
-            continue;
-        }
-        if (*(int *)array[idx] > num)
-        {
-            break;
-        }
-        if (*(int *)array[idx] == num)
-        {
-            count++;
-        }
-    }
-    return count * num;
+    // Nine digits always fit in an int
+    return (9 >= next - p_input->data) ? (int)(next - p_input->data) : 0;
 }
 
 /**
  * @brief Extracts two integers from a line of text.
  *
  * Parses a line of text for two integers and stores them in the `digits` array.
+ * Lines whose two ids both have the expected width take the fixed-width
+ * parser; any other line falls back to the general one.
  *
- * @param line Input line of text.
+ * @param line   Input line of text.
+ * @param p_end  End of the whole input, so the fixed-width parser may read
+ *               past the line.
+ * @param width  Expected number of digits per id, or 0 if unknown.
  * @param digits Array to store the extracted integers (size 2).
  * @return ERROR_SUCCESS on success, or an appropriate error code on failure.
  */
 static int
-extract_digits (const char *line, int digits[2])
+extract_digits (Span line, const char *p_end, int width, int digits[2])
 {
-    if ((NULL == line) || (NULL == digits))
+    if ((NULL == line.data) || (NULL == p_end) || (NULL == digits))
     {
         ERROR_LOG(
             "Invalid input to extract_digits: one or more inputs are NULL.");
         return ERROR_NULL_POINTER;
     }
 
-    if (sscanf(line, "%d %d", &digits[0], &digits[1]) != 2)
+    long long left  = 0;
+    long long right = 0;
+
+    if ((0 < width) && ((size_t)width < line.len)
+        && (ERROR_SUCCESS == parse_fixed(line.data, p_end, width, &left)))
+    {
+        Cursor gap = cursor_initialization(line.data + width,
+                                           line.len - (size_t)width);
+
+        cursor_skip_whitespace(&gap);
+
+        if ((gap.end - gap.pos == width)
+            && (ERROR_SUCCESS == parse_fixed(gap.pos, p_end, width, &right)))
+        {
+            digits[0] = (int)left;
+            digits[1] = (int)right;
+            return ERROR_SUCCESS;
+        }
+    }
+
+    Cursor cursor = cursor_from_span(line);
+
+    if ((false == cursor_next_int(&cursor, &digits[0]))
+        || (false == cursor_next_int(&cursor, &digits[1])))
     {
-        ERROR_LOG("Failed sscanf: unable to parse integers");
+        ERROR_LOG("Failed cursor_next_int: unable to parse integers");
         return ERROR_UNKNOWN;
     }
 
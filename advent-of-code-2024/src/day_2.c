@@ -1,13 +1,13 @@
+#include "arena.h"
 #include "array.h"
 #include "aux.h"
+#include "cursor.h"
 #include "day_2.h"
 #include "error.h"
+#include "input.h"
 
-#include <ctype.h>
 #include <stdbool.h>
-#include <stdio.h>
 #include <stdlib.h>
-#include <string.h>
 
 /**
  * @file day_2.c
@@ -15,17 +15,17 @@
  */
 
 /* Function Prototypes */
-static int extract_digits(const char *line, Array *record);
-bool       b_is_stable(void **record, int size);
-bool       b_is_stable_with_damper(void **record, int size);
+static int extract_digits(Span line, Array *record);
+bool       b_is_stable(ArrayView record);
+bool       b_is_stable_with_damper(ArrayView record);
 
 int
 day_2 (const char *filename, int result[2])
 {
-    FILE  *fptr              = NULL;
-    char   line[BUFFER_SIZE] = { 0 };
-    int    return_status     = ERROR_UNKNOWN;
-    Array *record            = NULL;
+    Input *p_input       = NULL;
+    int    return_status = ERROR_UNKNOWN;
+    Arena *p_arena       = NULL;
+    Array *record        = NULL;
 
     if ((NULL == filename) || (NULL == result))
     {
@@ -34,16 +34,17 @@ day_2 (const char *filename, int result[2])
         goto EXIT;
     }
 
-    fptr = fopen(filename, "r");
+    p_input = input_open_stream(filename);
 
-    if (NULL == fptr)
+    if (NULL == p_input)
     {
-        ERROR_LOG("Failed fopen: file not found");
+        ERROR_LOG("Failed input_open_stream: file not found");
         return_status = ERROR_FILE_NOT_FOUND;
         goto EXIT;
     }
 
-    record = array_initialization(TYPE_INT);
+    p_arena = arena_initialization(0);
+    record  = array_initialization_arena(TYPE_INT, p_arena);
 
     if (NULL == record)
     {
@@ -52,10 +53,11 @@ day_2 (const char *filename, int result[2])
         goto EXIT;
     }
 
-    int sum_one = 0;
-    int sum_two = 0;
+    int  sum_one = 0;
+    int  sum_two = 0;
+    Span line;
 
-    while (NULL != fgets(line, sizeof(line), fptr))
+    while (true == input_next_line(p_input, &line))
     {
         // extract record from line
         if (ERROR_SUCCESS != extract_digits(line, record))
@@ -63,9 +65,15 @@ day_2 (const char *filename, int result[2])
             goto EXIT;
         }
 
+        // blank lines hold no report
+        if (0 == record->idx)
+        {
+            continue;
+        }
+
         // add stability scores
-        sum_one += b_is_stable(record->list, record->idx);
-        sum_two += b_is_stable_with_damper(record->list, record->idx);
+        sum_one += b_is_stable(array_view(record));
+        sum_two += b_is_stable_with_damper(array_view(record));
 
         // reset array for next record
         array_reset(record);
@@ -73,36 +81,30 @@ day_2 (const char *filename, int result[2])
 
     result[0]     = sum_one;
     result[1]     = sum_two;
-    return_status = ERROR_SUCCESS;
+    return_status = p_input->status;
 
 EXIT:
-    if (NULL != fptr)
-    {
-        fclose(fptr);
-        fptr = NULL;
-    }
-
-    array_destroy(record);
+    input_close(p_input);
+    arena_destroy(p_arena);
     return return_status;
 }
 
 /**
- * @brief Extracts digits from a string and stores them in an Array.
+ * @brief Extracts integers from a line and stores them in an Array.
  *
- * This function loops through each character in the line. If a digit is
- * found, it is stored in the Array. The Array's index is incremented
- * for each digit.
+ * The integers are separated by whitespace; anything else on the line is
+ * an error.
  *
- * @param line Pointer to a null-terminated string containing digits.
+ * @param line Line of text containing the integers.
  * @param record Pointer to the Array structure where digits will be stored.
  * @return ERROR_SUCCESS on success, or an appropriate error code on failure.
  */
 static int
-extract_digits (const char *line, Array *record)
+extract_digits (Span line, Array *record)
 {
-    int return_status = ERROR_UNKNOWN;
+    int return_status = ERROR_SUCCESS;
 
-    if ((NULL == line) || (NULL == record))
+    if ((NULL == line.data) || (NULL == record))
     {
         ERROR_LOG(
             "Invalid input to extract_digits: one or more inputs are NULL.");
@@ -110,11 +112,11 @@ extract_digits (const char *line, Array *record)
         goto EXIT;
     }
 
-    while ('\0' != *line)
-    {
-        char *endline;
-        int   ele = (int)strtol(line, &endline, 10);
+    Cursor cursor = cursor_from_span(line);
+    int    ele    = 0;
 
+    while (true == cursor_next_int(&cursor, &ele))
+    {
         return_status = array_add(record, &ele);
 
         if (ERROR_SUCCESS != return_status)
@@ -122,31 +124,14 @@ extract_digits (const char *line, Array *record)
             ERROR_LOG("Failed array_add: unable to add element to array");
             goto EXIT;
         }
+    }
 
-        // Check if no valid number was found
-        if (line == endline)
-        {
-            if (isspace((unsigned char)*line))
-            {
-                line++; // Skip whitespace
-                continue;
-            }
-            else
-            {
-                ERROR_LOG("Failed isspace: invalid input found");
-                return_status = ERROR_INVALID_INPUT;
-                goto EXIT;
-            }
-        }
-
-        // Advance the line pointer to the next position
-        line = endline;
-
-        // Skip any trailing spaces
-        while (isspace((unsigned char)*line))
-        {
-            line++;
-        }
+    // Only trailing whitespace may be left once the integers run out
+    if (false == cursor_at_end(&cursor))
+    {
+        ERROR_LOG("Failed cursor_next_int: invalid input found");
+        return_status = ERROR_INVALID_INPUT;
+        goto EXIT;
     }
 
 EXIT:
@@ -162,25 +147,26 @@ EXIT:
  * and the sequence does not change direction (i.e., it either only increases
  * or only decreases).
  *
- * @param record Pointer to an array of integers representing the sequence.
- * @param size The size of the array.
+ * @param record View of the integers representing the sequence.
  * @return `true` if the sequence is stable, `false` otherwise.
  */
 bool
-b_is_stable (void **record, int size)
+b_is_stable (ArrayView record)
 {
     bool stable = true;
     bool pos    = false;
     bool neg    = false;
+    int  size   = ARRAY_VIEW_SIZE(record);
 
-    if ((NULL == record) || (1 >= size))
+    if ((NULL == record.data) || (1 >= size))
     {
         return stable;
     }
 
     for (int idx = 0; idx < size - 1; idx++)
     {
-        int diff = *(int *)record[idx] - *(int *)record[idx + 1];
+        int diff = ARRAY_VIEW_AT(record, int, idx)
+                   - ARRAY_VIEW_AT(record, int, idx + 1);
 
         // Check if the difference is within the valid range
         if (1 > abs(diff) || 3 < abs(diff))
@@ -214,57 +200,34 @@ b_is_stable (void **record, int size)
  * @brief Checks the stability of a sequence of integers, allowing one
  * element to be removed.
  *
- * @param record Pointer to an array of integers representing the sequence.
- * @param size The size of the array.
+ * Each candidate removal is checked through a view that hides the removed
+ * element, so no record is ever copied.
+ *
+ * @param record View of the integers representing the sequence.
  * @return `true` if the sequence is stable (either initially or after
  * removing one element), `false` otherwise.
  */
 bool
-b_is_stable_with_damper (void **record, int size)
+b_is_stable_with_damper (ArrayView record)
 {
-    bool   stable     = false;
-    void **mod_record = NULL;
+    bool stable = false;
 
-    if ((NULL == record) || (1 >= size))
+    if ((NULL == record.data) || (1 >= ARRAY_VIEW_SIZE(record)))
     {
         goto EXIT;
     }
 
     // First, check if the sequence is stable without modification
-    if (b_is_stable(record, size))
+    if (b_is_stable(record))
     {
         stable = true;
         goto EXIT;
     }
 
-    // Next, attempt to remove an element and check stability
-    mod_record = calloc(size - 1, sizeof(void *));
-
-    if (NULL == mod_record)
-    {
-        ERROR_LOG("Failed calloc: unable to allocate memory");
-        goto EXIT;
-    }
-
     // Attempt to remove one element and check if the sequence becomes stable
-    for (int idx = 0; idx < size; idx++)
+    for (int idx = 0; idx < record.len; idx++)
     {
-        for (int jdx = 0; jdx < size - 1; jdx++)
-        {
-            mod_record[jdx] = NULL;
-        }
-
-        // Copy the elements, skipping the i-th element
-        for (int jdx = 0, kdx = 0; jdx < size; jdx++)
-        {
-            if (jdx != idx)
-            {
-                mod_record[kdx++] = record[jdx];
-            }
-        }
-
-        // Check if the new sequence is stable
-        if (b_is_stable(mod_record, size - 1))
+        if (b_is_stable(array_view_without(record, idx)))
         {
             stable = true;
             goto EXIT;
@@ -272,12 +235,6 @@ b_is_stable_with_damper (void **record, int size)
     }
 
 EXIT:
-    if (NULL != mod_record)
-    {
-        free(mod_record);
-        mod_record = NULL;
-    }
-
     return stable;
 }
 
@@ -1,9 +1,11 @@
-#include "array.h"
 #include "aux.h"
+#include "cursor.h"
 #include "day_3.h"
 #include "error.h"
+#include "input.h"
+#include "kernel.h"
+#include "vector.h"
 
-#include <ctype.h>
 #include <stdbool.h>
 #include <stdio.h>
 #include <stdlib.h>
@@ -16,25 +18,25 @@
 
 typedef struct
 {
-    Array *multiplicand;
-    Array *multiplier;
-    Array *conditional;
-    bool   b_do_execute;
+    IntArray multiplicand;
+    IntArray multiplier;
+    IntArray conditional;
+    bool     b_do_execute;
 } PatternData;
 
 /* Function Prototypes */
-void         find_pattern(const char *input, PatternData *data);
-bool         matches_pattern(const char *str, int *a, int *b);
+void         find_pattern(Span input, PatternData *data);
+const char  *find_literal(const char *pos, const char *end, const char *lit);
+bool         matches_pattern(Cursor *cursor, int *a, int *b);
 PatternData *patterndata_initialization();
 void         patterndata_destroy(PatternData *data);
 
 int
 day_3 (const char *filename, int result[2])
 {
-    FILE        *fptr              = NULL;
-    char         line[BUFFER_SIZE] = { 0 };
-    int          return_status     = ERROR_UNKNOWN;
-    PatternData *data              = NULL;
+    Input       *p_input       = NULL;
+    int          return_status = ERROR_UNKNOWN;
+    PatternData *data          = NULL;
 
     if ((NULL == filename) || (NULL == result))
     {
@@ -43,18 +45,15 @@ day_3 (const char *filename, int result[2])
         goto EXIT;
     }
 
-    fptr = fopen(filename, "r");
+    p_input = input_open_stream(filename);
 
-    if (NULL == fptr)
+    if (NULL == p_input)
     {
-        ERROR_LOG("Failed fopen: file not found");
+        ERROR_LOG("Failed input_open_stream: file not found");
         return_status = ERROR_FILE_NOT_FOUND;
         goto EXIT;
     }
 
-    int sum_one = 0;
-    int sum_two = 0;
-
     data = patterndata_initialization();
 
     if (NULL == data)
@@ -65,65 +64,121 @@ day_3 (const char *filename, int result[2])
         goto EXIT;
     }
 
-    while (NULL != fgets(line, sizeof(line), fptr))
+    // Lines are scanned in place whatever their length; do() and don't()
+    // carry over from one line to the next
+    Span line;
+
+    while (true == input_next_line(p_input, &line))
     {
         find_pattern(line, data);
     }
 
-    if ((data->multiplicand->idx != data->multiplier->idx)
-        || (data->conditional->idx != data->multiplier->idx))
+    if (ERROR_SUCCESS != p_input->status)
     {
-        ERROR_LOG("Failed find_pattern: unable to parse correctly");
+        ERROR_LOG("Failed input_next_line: unable to read input");
+        return_status = p_input->status;
         goto EXIT;
     }
 
-    for (int idx = 0; idx < data->multiplicand->idx; idx++)
+    if ((data->multiplicand.idx != data->multiplier.idx)
+        || (data->conditional.idx != data->multiplier.idx))
     {
-        sum_one += (*(int *)data->multiplicand->list[idx]
-                    * *(int *)data->multiplier->list[idx]);
-        sum_two += (*(int *)data->multiplicand->list[idx]
-                    * *(int *)data->multiplier->list[idx]
-                    * *(int *)data->conditional->list[idx]);
+        ERROR_LOG("Failed find_pattern: unable to parse correctly");
+        goto EXIT;
     }
 
-    result[0]     = sum_one;
-    result[1]     = sum_two;
+    const int *multiplicand = data->multiplicand.data;
+    const int *multiplier   = data->multiplier.data;
+    const int *conditional  = data->conditional.data;
+    int        count        = data->multiplicand.idx;
+
+    // Part 2 only counts products recorded while enabled by do()
+    result[0]     = (int)kernel_dot_int(multiplicand, multiplier, count);
+    result[1]     = (int)kernel_dot_masked_int(
+        multiplicand, multiplier, conditional, count);
     return_status = ERROR_SUCCESS;
 
 EXIT:
-    if (NULL != fptr)
+    input_close(p_input);
+    patterndata_destroy(data);
+    return return_status;
+}
+
+/**
+ * @brief Finds the first occurrence of a literal within a bounded range.
+ *
+ * The range need not be NUL-terminated, unlike for `strstr`.
+ *
+ * @param pos Pointer to the first character to search.
+ * @param end Pointer one past the last character to search.
+ * @param lit NUL-terminated literal to find.
+ * @return Pointer to the start of the match, or NULL if there is none.
+ */
+const char *
+find_literal (const char *pos, const char *end, const char *lit)
+{
+    size_t len = strlen(lit);
+
+    while ((size_t)(end - pos) >= len)
     {
-        fclose(fptr);
-        fptr = NULL;
+        pos = memchr(pos, lit[0], (size_t)(end - pos) - len + 1);
+
+        if (NULL == pos)
+        {
+            break;
+        }
+
+        if (0 == memcmp(pos, lit, len))
+        {
+            return pos;
+        }
+
+        pos++;
     }
 
-    patterndata_destroy(data);
-    return return_status;
+    return NULL;
 }
 
 /**
- * @brief Parses an input string to find and process patterns of interest.
+ * @brief Parses an input span to find and process patterns of interest.
  *
- * @param input The input string to parse.
+ * @param input The input text to parse.
  * @param data Pointer to a PatternData structure that holds parsed data.
  */
 void
-find_pattern (const char *input, PatternData *data)
+find_pattern (Span input, PatternData *data)
 {
-    if ((NULL == input) || (NULL == data))
+    if ((NULL == input.data) || (NULL == data))
     {
         ERROR_LOG(
             "Invalid input to find_pattern: one or more inputs are NULL.");
         return;
     }
 
-    const char *current_pos = input;
+    const char *end         = input.data + input.len;
+    const char *current_pos = input.data;
+    const char *next_mul    = find_literal(current_pos, end, "mul(");
+    const char *next_do     = find_literal(current_pos, end, "do()");
+    const char *next_dont   = find_literal(current_pos, end, "don't()");
 
     while (NULL != current_pos)
     {
-        const char *next_mul  = strstr(current_pos, "mul(");
-        const char *next_do   = strstr(current_pos, "do()");
-        const char *next_dont = strstr(current_pos, "don't()");
+        // Only rescan for a pattern once its cached match has been passed,
+        // so each pattern's scan crosses the input once in total
+        if ((NULL != next_mul) && (next_mul < current_pos))
+        {
+            next_mul = find_literal(current_pos, end, "mul(");
+        }
+
+        if ((NULL != next_do) && (next_do < current_pos))
+        {
+            next_do = find_literal(current_pos, end, "do()");
+        }
+
+        if ((NULL != next_dont) && (next_dont < current_pos))
+        {
+            next_dont = find_literal(current_pos, end, "don't()");
+        }
 
         // Find the nearest match among the patterns
         const char *next_match = next_mul;
@@ -148,16 +203,21 @@ find_pattern (const char *input, PatternData *data)
         // Process the found match
         if (0 == strncmp(next_match, "mul(", 4))
         {
-            int a, b;
-            if (matches_pattern(next_match, &a, &b))
+            int    a, b;
+            Cursor cursor = cursor_initialization(
+                next_match, (size_t)(end - next_match));
+
+            if (matches_pattern(&cursor, &a, &b))
             {
-                if ((ERROR_SUCCESS != array_add(data->multiplicand, &a))
-                    || (ERROR_SUCCESS != array_add(data->multiplier, &b))
+                if ((ERROR_SUCCESS != int_array_push(&data->multiplicand, a))
+                    || (ERROR_SUCCESS != int_array_push(&data->multiplier, b))
                     || (ERROR_SUCCESS
-                        != array_add(data->conditional, &data->b_do_execute)))
+                        != int_array_push(&data->conditional,
+                                          data->b_do_execute)))
                 {
                     ERROR_LOG(
-                        "Failed array_add: unable to add element to array");
+                        "Failed int_array_push: unable to add element to "
+                        "array");
                     break;
                 }
             }
@@ -179,57 +239,28 @@ find_pattern (const char *input, PatternData *data)
 }
 
 /**
- * @brief Matches a string against the "mul(a, b)" pattern and extracts
- integers
- * a and b.
+ * @brief Matches the text at a cursor against the "mul(a,b)" pattern and
+ * extracts integers a and b.
  *
- * @param str The input string to match.
+ * @param cursor Cursor positioned at the text to match; it is advanced past
+ * whatever was consumed.
  * @param a Pointer to store the first extracted integer.
  * @param b Pointer to store the second extracted integer.
  *
- * @return true if the string matches the pattern and integers are
+ * @return true if the text matches the pattern and integers are
  * successfully extracted, false otherwise.
  */
 bool
-matches_pattern (const char *str, int *a, int *b)
+matches_pattern (Cursor *cursor, int *a, int *b)
 {
-    bool return_status = false;
-
-    if ((NULL == str) || (NULL == a) || (NULL == b))
-    {
-        goto EXIT;
-    }
-
-    if (0 != strncmp(str, "mul(", 4))
-    {
-        goto EXIT;
-    }
-
-    str += 4; // Skip "mul("
-    char *end_ptr;
-
-    // Extract the first integer
-    *a = (int)strtol(str, &end_ptr, 10);
-
-    if ((end_ptr == str) || (',' != *end_ptr))
-    {
-        goto EXIT; // No valid integer or missing ','
-    }
-
-    str = end_ptr + 1; // Move past ','
-
-    // Extract the second integer
-    *b = (int)strtol(str, &end_ptr, 10);
-
-    if ((end_ptr == str) || (')' != *end_ptr))
+    if ((NULL == cursor) || (NULL == a) || (NULL == b))
     {
-        goto EXIT; // No valid integer or missing ')'
+        return false;
     }
 
-    return_status = true; // successfully extracted digits
-
-EXIT:
-    return return_status;
+    return cursor_match(cursor, "mul(") && cursor_next_int(cursor, a)
+           && cursor_match(cursor, ",") && cursor_next_int(cursor, b)
+           && cursor_match(cursor, ")");
 }
 
 /**
@@ -252,20 +283,10 @@ patterndata_initialization ()
     }
 
     data->b_do_execute = true;
-    data->conditional  = NULL;
-    data->multiplicand = NULL;
-    data->multiplier   = NULL;
-
-    data->conditional  = array_initialization(TYPE_INT);
-    data->multiplicand = array_initialization(TYPE_INT);
-    data->multiplier   = array_initialization(TYPE_INT);
 
-    if ((NULL == data->conditional) || (NULL == data->multiplicand)
-        || (NULL == data->multiplier))
-    {
-        patterndata_destroy(data);
-        data = NULL;
-    }
+    int_array_init(&data->conditional);
+    int_array_init(&data->multiplicand);
+    int_array_init(&data->multiplier);
 
 EXIT:
     return data;
@@ -282,9 +303,9 @@ patterndata_destroy (PatternData *data)
 {
     if (NULL != data)
     {
-        array_destroy(data->conditional);
-        array_destroy(data->multiplicand);
-        array_destroy(data->multiplier);
+        int_array_destroy(&data->conditional);
+        int_array_destroy(&data->multiplicand);
+        int_array_destroy(&data->multiplier);
         free(data);
         data = NULL;
     }
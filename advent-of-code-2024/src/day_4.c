@@ -1,7 +1,10 @@
+#include "arena.h"
 #include "aux.h"
 #include "day_4.h"
 #include "error.h"
+#include "input.h"
 #include "table.h"
+#include "vector.h"
 
 #include <stdbool.h>
 #include <stdio.h>
@@ -13,49 +16,57 @@
  * @brief Implementation of the Day 4 challenge.
  */
 
-/* Coordinate directions for 2D movement in a grid */
-#define COORDS                                                        \
-    {                                                                 \
-        { 0, 1 }, { 0, -1 },     /* Forward, Backward */              \
-            { 1, 0 }, { -1, 0 }, /* Down, Up */                       \
-            { 1, 1 }, { 1, -1 }, /* Diagonal Down-Right, Down-Left */ \
-            { -1, 1 },                                                \
-        {                                                             \
-            -1, -1                                                    \
-        } /* Diagonal Up-Right, Up-Left */                            \
-    }
+/* Padding for cells past the end of a short window row */
+#define FILL_CHAR '.'
+
+/**
+ * @brief Scratch buffers reused by every search.
+ */
+typedef struct
+{
+    Table     *p_scratch; /**< Transposed or diagonal copy of a window. */
+    IntArray   starts;    /**< Match positions within one scratch row. */
+    PointArray found;     /**< Grid coordinates of match centres. */
+} SearchScratch;
 
 /* Function Prototypes */
-static int  part_one(Table *p_table, Array *p_found, const char *line);
-static int  part_two(Table *p_table, Array *p_found, const char *p_line);
-static int  table_rotate(Table *p_table, const char *p_data);
-static int  table_search_frontback(Table      *p_table,
-                                   Array      *p_found,
-                                   const char *p_word);
-static int  table_search_updown(Table      *p_table,
-                                Array      *p_found,
-                                const char *p_word);
-static int  table_search_diagonal(Table      *p_table,
-                                  Array      *p_found,
-                                  const char *p_word);
-static int  table_search_row(Table      *p_table,
-                             Array      *p_found,
-                             int         row,
-                             const char *p_word,
-                             const int   dir_range[2]);
-static bool is_word_found(
-    Table *table, const char *p_word, int row, int col, int dx, int dy);
-static int count_overlaps(Array *p_array);
+static int part_one(Table         *p_table,
+                    SearchScratch *p_work,
+                    const char    *p_line,
+                    int            len,
+                    int           *p_count);
+static int part_two(Table         *p_table,
+                    SearchScratch *p_work,
+                    const char    *p_line,
+                    int            len,
+                    int           *p_count);
+static int table_rotate(Table *p_table, const char *p_data, int len);
+static int search_row(const Array *p_row,
+                      const char  *p_word,
+                      IntArray    *p_starts);
+static int count_in_rows(const Table   *p_table,
+                         int            num_rows,
+                         const char    *p_word,
+                         SearchScratch *p_work,
+                         int           *p_count);
+static int find_centres(const Table   *p_table,
+                        bool           b_anti,
+                        const char    *p_word,
+                        SearchScratch *p_work);
+static int count_overlaps(const PointArray *p_array);
 
 int
 day_4 (const char *filename, int result[2])
 {
-    FILE  *p_file            = NULL;
-    Table *p_table_one       = NULL;
-    Table *p_table_two       = NULL;
-    Array *p_found           = NULL;
-    char   line[BUFFER_SIZE] = { 0 };
-    int    status            = ERROR_UNKNOWN;
+    Input        *p_input     = NULL;
+    Arena        *p_arena     = NULL;
+    Table        *p_table_one = NULL;
+    Table        *p_table_two = NULL;
+    SearchScratch work        = { NULL };
+    int           status      = ERROR_UNKNOWN;
+
+    int_array_init(&work.starts);
+    point_array_init(&work.found);
 
     if ((NULL == filename) || (NULL == result))
     {
@@ -64,33 +75,49 @@ day_4 (const char *filename, int result[2])
         goto EXIT;
     }
 
-    p_table_one = table_initialization(TYPE_CHAR, 4); // 4 row chunks for part 1
-    p_table_two = table_initialization(TYPE_CHAR, 3); // 3 row chunks for part 2
-    p_found     = array_initialization(
-        TYPE_INT_PTR); // found coords for each table chunk
+    p_arena = arena_initialization(0);
 
-    if ((NULL == p_table_one) || (NULL == p_table_two) || (NULL == p_found))
+    if (NULL == p_arena)
+    {
+        ERROR_LOG("Failed arena_initialization: unable to allocate memory");
+        status = ERROR_OUT_OF_MEMORY;
+        goto EXIT;
+    }
+
+    // 4 row chunks for part 1, 3 row chunks for part 2; the scratch table
+    // grows to hold a chunk's columns or diagonals as rows
+    p_table_one    = table_initialization_arena(TYPE_CHAR, 4, p_arena);
+    p_table_two    = table_initialization_arena(TYPE_CHAR, 3, p_arena);
+    work.p_scratch = table_initialization_arena(TYPE_CHAR, 1, p_arena);
+
+    if ((NULL == p_table_one) || (NULL == p_table_two)
+        || (NULL == work.p_scratch))
     {
         ERROR_LOG("Failed initializations: unable to allocate memory");
         status = ERROR_OUT_OF_MEMORY;
         goto EXIT;
     }
 
-    p_file = fopen(filename, "r");
+    p_input = input_open_stream(filename);
 
-    if (NULL == p_file)
+    if (NULL == p_input)
     {
-        ERROR_LOG("Failed fopen: file not found");
+        ERROR_LOG("Failed input_open_stream: file not found");
         status = ERROR_FILE_NOT_FOUND;
         goto EXIT;
     }
 
-    int sum_one = 0;
-    int sum_two = 0;
+    int  sum_one = 0;
+    int  sum_two = 0;
+    Span line;
 
-    while (NULL != fgets(line, sizeof(line), p_file))
+    // Rows are copied straight from the input into the tables
+    while (true == input_next_line(p_input, &line))
     {
-        status = part_one(p_table_one, p_found, line);
+        int count = 0;
+        int len   = (int)line.len;
+
+        status = part_one(p_table_one, &work, line.data, len, &count);
 
         if (ERROR_SUCCESS != status)
         {
@@ -98,9 +125,9 @@ day_4 (const char *filename, int result[2])
             goto EXIT;
         }
 
-        sum_one += p_found->idx;
+        sum_one += count;
 
-        status = part_two(p_table_two, p_found, line);
+        status = part_two(p_table_two, &work, line.data, len, &count);
 
         if (ERROR_SUCCESS != status)
         {
@@ -108,23 +135,18 @@ day_4 (const char *filename, int result[2])
             goto EXIT;
         }
 
-        sum_two += count_overlaps(p_found);
+        sum_two += count;
     }
 
     result[0] = sum_one;
     result[1] = sum_two;
-    status    = ERROR_SUCCESS;
+    status    = p_input->status;
 
 EXIT:
-    if (NULL != p_file)
-    {
-        fclose(p_file);
-        p_file = NULL;
-    }
-
-    table_destroy(p_table_one);
-    table_destroy(p_table_two);
-    array_destroy(p_found);
+    input_close(p_input);
+    int_array_destroy(&work.starts);
+    point_array_destroy(&work.found);
+    arena_destroy(p_arena);
     return status;
 }
 
@@ -132,17 +154,30 @@ EXIT:
  * @brief Processes the first part of the challenge by rotating the table and
  * searching for all instances of the word "XMAS"
  *
+ * Only words ending in the newest row are counted, so every word is counted
+ * once. Horizontal words are searched in the newest row; vertical and
+ * diagonal words are searched as rows of the transposed and diagonal copies
+ * of the table, whose full-height rows necessarily touch the newest row.
+ *
  * @param p_table Pointer to the Table structure to be processed.
- * @param p_found Pointer to the Array structure that stores the coordinates of
- * found words.
+ * @param p_work  Pointer to the scratch buffers.
  * @param p_line  Pointer to the input line to be processed.
+ * @param len     Number of characters in the line.
+ * @param p_count Output for the number of words found.
  *
  * @return ERROR_SUCCESS on success, or an appropriate error code on failure.
  */
 static int
-part_one (Table *p_table, Array *p_found, const char *line)
+part_one (Table         *p_table,
+          SearchScratch *p_work,
+          const char    *p_line,
+          int            len,
+          int           *p_count)
 {
-    int status = table_rotate(p_table, line);
+    const char fill   = FILL_CHAR;
+    int        status = table_rotate(p_table, p_line, len);
+
+    *p_count = 0;
 
     if (ERROR_SUCCESS != status)
     {
@@ -150,39 +185,54 @@ part_one (Table *p_table, Array *p_found, const char *line)
         goto EXIT;
     }
 
-    status = array_reset(p_found);
+    int_array_reset(&p_work->starts);
+    status = search_row(
+        TABLE_ROW(p_table, p_table->num_rows - 1), "XMAS", &p_work->starts);
 
     if (ERROR_SUCCESS != status)
     {
-        ERROR_LOG("Failed array_reset: unable to reset found array");
+        ERROR_LOG("Failed search_row: unable to search newest row for word");
         goto EXIT;
     }
 
-    status = table_search_frontback(p_table, p_found, "XMAS");
+    *p_count += p_work->starts.idx;
+    status = table_transpose(p_table, p_work->p_scratch, &fill);
 
-    if (ERROR_SUCCESS != status)
+    if (ERROR_SUCCESS == status)
     {
-        ERROR_LOG(
-            "Failed table_search_frontback: unable to search table for word");
-        goto EXIT;
+        status = count_in_rows(p_work->p_scratch,
+                               table_width(p_table),
+                               "XMAS",
+                               p_work,
+                               p_count);
     }
 
-    status = table_search_updown(p_table, p_found, "XMAS");
-
     if (ERROR_SUCCESS != status)
     {
-        ERROR_LOG(
-            "Failed table_search_updown: unable to search table for word");
+        ERROR_LOG("Failed table_transpose: unable to search columns for word");
         goto EXIT;
     }
 
-    status = table_search_diagonal(p_table, p_found, "XMAS");
-
-    if (ERROR_SUCCESS != status)
+    for (int pass = 0; pass < 2; pass++)
     {
-        ERROR_LOG(
-            "Failed table_search_diagonal: unable to search table for word");
-        goto EXIT;
+        bool b_anti    = (1 == pass);
+        int  width     = table_width(p_table);
+        int  num_diags = (0 < width) ? p_table->num_rows + width - 1 : 0;
+
+        status = table_diagonals(p_table, p_work->p_scratch, b_anti, &fill);
+
+        if (ERROR_SUCCESS == status)
+        {
+            status = count_in_rows(
+                p_work->p_scratch, num_diags, "XMAS", p_work, p_count);
+        }
+
+        if (ERROR_SUCCESS != status)
+        {
+            ERROR_LOG(
+                "Failed table_diagonals: unable to search diagonals for word");
+            goto EXIT;
+        }
     }
 
 EXIT:
@@ -193,17 +243,27 @@ EXIT:
  * @brief Processes the second part of the challenge by rotating the table and
  * searching for for diagonal instances of "MAS"
  *
+ * An X-MAS is a cell that is the centre of a "MAS" on both a diagonal and
+ * an anti-diagonal.
+ *
  * @param p_table Pointer to the Table structure to be processed.
- * @param p_found Pointer to the Array structure that stores the coordinates of
- * found words.
+ * @param p_work  Pointer to the scratch buffers.
  * @param p_line  Pointer to the input line to be processed.
+ * @param len     Number of characters in the line.
+ * @param p_count Output for the number of X-MAS shapes found.
  *
  * @return ERROR_SUCCESS on success, or an appropriate error code on failure.
  */
 static int
-part_two (Table *p_table, Array *p_found, const char *p_line)
+part_two (Table         *p_table,
+          SearchScratch *p_work,
+          const char    *p_line,
+          int            len,
+          int           *p_count)
 {
-    int status = table_rotate(p_table, p_line);
+    int status = table_rotate(p_table, p_line, len);
+
+    *p_count = 0;
 
     if (ERROR_SUCCESS != status)
     {
@@ -211,23 +271,23 @@ part_two (Table *p_table, Array *p_found, const char *p_line)
         goto EXIT;
     }
 
-    status = array_reset(p_found);
+    point_array_reset(&p_work->found);
 
-    if (ERROR_SUCCESS != status)
+    status = find_centres(p_table, false, "MAS", p_work);
+
+    if (ERROR_SUCCESS == status)
     {
-        ERROR_LOG("Failed array_reset: unable to reset found array");
-        goto EXIT;
+        status = find_centres(p_table, true, "MAS", p_work);
     }
 
-    status = table_search_diagonal(p_table, p_found, "MAS");
-
     if (ERROR_SUCCESS != status)
     {
-        ERROR_LOG(
-            "Failed table_search_diagonal: unable to search table for word");
+        ERROR_LOG("Failed find_centres: unable to search table for word");
         goto EXIT;
     }
 
+    *p_count = count_overlaps(&p_work->found);
+
 EXIT:
     return status;
 }
@@ -237,12 +297,13 @@ EXIT:
  * last row.
  *
  * @param p_table Pointer to the table to update.
- * @param p_data  Pointer to the string data to add.
+ * @param p_data  Pointer to the characters to add.
+ * @param len     Number of characters to add.
  *
  * @return ERROR_SUCCESS on success, or an appropriate error code on failure.
  */
 static int
-table_rotate (Table *p_table, const char *p_data)
+table_rotate (Table *p_table, const char *p_data, int len)
 {
     int status = ERROR_UNKNOWN;
 
@@ -254,239 +315,142 @@ table_rotate (Table *p_table, const char *p_data)
         goto EXIT;
     }
 
-    // Shift rows upward
-    for (int row = 0; row < p_table->num_rows - 1; row++)
-    {
-        status = table_copy_row(p_table, row + 1, row);
-
-        if (ERROR_SUCCESS != status)
-        {
-            ERROR_LOG("Failed table_copy_row: unable to shift rows upward");
-            goto EXIT;
-        }
-    }
-
-    // Reset the last row
-    status = table_reset_row(p_table, p_table->num_rows - 1);
+    // Recycle the oldest row as the newest; the line is copied in one go
+    status = table_push_row(p_table, p_data, len);
 
     if (ERROR_SUCCESS != status)
     {
-        ERROR_LOG("Failed table_reset_row: unable to clear the last row");
+        ERROR_LOG("Failed table_push_row: unable to add new row to table");
         goto EXIT;
     }
 
-    // Add new data to the last row
-    for (int idx = 0; p_data[idx] != '\0'; idx++)
-    {
-        status
-            = table_add_element(p_table, p_table->num_rows - 1, &p_data[idx]);
-
-        if (ERROR_SUCCESS != status)
-        {
-            ERROR_LOG(
-                "Failed table_add_element: unable to add new row to table");
-            goto EXIT;
-        }
-    }
-
 EXIT:
     return status;
 }
 
 /**
- * @brief Searches the table for the word in the front and back direction. Only
- * searches the newest row to prevent repeats.
- *
- * @param p_table Pointer to the table to search.
- * @param p_found Array to store the found coordinates.
- * @param p_word Word to search for in the table.
+ * @brief Finds every occurrence of a word, forwards or backwards, in a row.
  *
- * @return ERROR_SUCCESS on success, or an appropriate error code on failure.
- */
-static int
-table_search_frontback (Table *p_table, Array *p_found, const char *p_word)
-{
-    if (p_table == NULL || p_word == NULL || p_found == NULL)
-    {
-        ERROR_LOG(
-            "Invalid input to table_search_frontback: one or more inputs are "
-            "NULL.");
-        return ERROR_NULL_POINTER;
-    }
-
-    const int directions[] = { 0, 2 };
-    return table_search_row(
-        p_table, p_found, p_table->num_rows - 1, p_word, directions);
-}
-
-/**
- * @brief Searches the table for the word in the up and down direction.
+ * The row is scanned left to right as one contiguous run of characters.
  *
- * @param p_table Pointer to the table to search.
- * @param p_found Array to store the found coordinates.
- * @param p_word Word to search for in the table.
+ * @param p_row    Row of characters to search.
+ * @param p_word   Word to search for.
+ * @param p_starts Array the index of each match's leftmost cell is
+ * appended to.
  *
  * @return ERROR_SUCCESS on success, or an appropriate error code on failure.
  */
 static int
-table_search_updown (Table *p_table, Array *p_found, const char *p_word)
+search_row (const Array *p_row, const char *p_word, IntArray *p_starts)
 {
-    int status = ERROR_UNKNOWN;
+    const char *cells = p_row->data;
+    int         len   = (int)strlen(p_word);
 
-    if ((NULL == p_table) || (NULL == p_word) || (NULL == p_found))
+    for (int col = 0; col + len <= p_row->idx; col++)
     {
-        ERROR_LOG(
-            "Invalid input to table_search_updown: one or more inputs are "
-            "NULL.");
-        return ERROR_NULL_POINTER;
-    }
-
-    const int directions[] = { 2, 4 };
+        bool b_forward  = (cells[col] == p_word[0]);
+        bool b_backward = (cells[col] == p_word[len - 1]);
 
-    for (int row = 0; row < p_table->num_rows; row++)
-    {
-        status = table_search_row(p_table, p_found, row, p_word, directions);
+        for (int idx = 1; (b_forward || b_backward) && (idx < len); idx++)
+        {
+            b_forward  = b_forward && (cells[col + idx] == p_word[idx]);
+            b_backward = b_backward
+                         && (cells[col + idx] == p_word[len - 1 - idx]);
+        }
 
-        if (ERROR_SUCCESS != status)
+        if ((b_forward && (ERROR_SUCCESS != int_array_push(p_starts, col)))
+            || (b_backward
+                && (ERROR_SUCCESS != int_array_push(p_starts, col))))
         {
-            ERROR_LOG("Failed table_search_row: unable to search row for word");
-            break;
+            ERROR_LOG("Failed int_array_push: unable to store match");
+            return ERROR_OUT_OF_MEMORY;
         }
     }
 
-    return status;
+    return ERROR_SUCCESS;
 }
 
 /**
- * @brief Searches the table for the word in diagonal directions.
+ * @brief Counts the occurrences of a word in the leading rows of a table.
  *
- * @param p_table Pointer to the table to search.
- * @param p_found Array to store the found coordinates.
- * @param p_word Word to search for in the table.
+ * @param p_table  Table whose rows are searched.
+ * @param num_rows Number of leading rows to search.
+ * @param p_word   Word to search for.
+ * @param p_work   Pointer to the scratch buffers.
+ * @param p_count  Counter the number of matches is added to.
  *
  * @return ERROR_SUCCESS on success, or an appropriate error code on failure.
  */
 static int
-table_search_diagonal (Table *p_table, Array *p_found, const char *p_word)
+count_in_rows (const Table   *p_table,
+               int            num_rows,
+               const char    *p_word,
+               SearchScratch *p_work,
+               int           *p_count)
 {
-    int status = ERROR_UNKNOWN;
-
-    if ((NULL == p_table) || (NULL == p_word) || (NULL == p_found))
-    {
-        ERROR_LOG(
-            "Invalid input to table_search_diagonal: one or more inputs are "
-            "NULL.");
-        return ERROR_NULL_POINTER;
-    }
-
-    const int directions[] = { 4, 8 };
+    int status = ERROR_SUCCESS;
 
-    for (int row = 0; row < p_table->num_rows; row++)
+    for (int row = 0; (ERROR_SUCCESS == status) && (row < num_rows); row++)
     {
-        status = table_search_row(p_table, p_found, row, p_word, directions);
-
-        if (ERROR_SUCCESS != status)
-        {
-            ERROR_LOG("Failed table_search_row: unable to search row for word");
-            break;
-        }
+        int_array_reset(&p_work->starts);
+        status = search_row(TABLE_ROW(p_table, row), p_word, &p_work->starts);
+        *p_count += p_work->starts.idx;
     }
 
     return status;
 }
 
 /**
- * @brief Searches the table for a word along a specified row and direction.
+ * @brief Records the centre cell of every word along a table's diagonals.
  *
- * @param p_table Pointer to the table to search.
- * @param p_found Array to store the found coordinates.
- * @param row Row to search in the table.
- * @param p_word Word to search for in the table.
- * @param dir_range Direction range for searching (e.g., forward/backward).
+ * Matches are found as rows of the diagonal copy of the table and mapped
+ * back to their coordinates within the table.
+ *
+ * @param p_table Table to search.
+ * @param b_anti  Whether to search anti-diagonals instead of diagonals.
+ * @param p_word  Word to search for.
+ * @param p_work  Pointer to the scratch buffers; centres are appended to
+ * `found`.
  *
  * @return ERROR_SUCCESS on success, or an appropriate error code on failure.
  */
 static int
-table_search_row (Table      *p_table,
-                  Array      *p_found,
-                  int         row,
-                  const char *p_word,
-                  const int   dir_range[2])
+find_centres (const Table   *p_table,
+              bool           b_anti,
+              const char    *p_word,
+              SearchScratch *p_work)
 {
-    int  coords[8][2] = COORDS;
-    int *p_loc        = calloc(2, sizeof(int));
-
-    if (NULL == p_loc)
+    const char fill      = FILL_CHAR;
+    int        width     = table_width(p_table);
+    int        num_diags = (0 < width) ? p_table->num_rows + width - 1 : 0;
+    int        step      = (true == b_anti) ? -1 : 1;
+    int        status
+        = table_diagonals(p_table, p_work->p_scratch, b_anti, &fill);
+
+    for (int diag = 0; (ERROR_SUCCESS == status) && (diag < num_diags);
+         diag++)
     {
-        ERROR_LOG("Failed calloc: unable to allocate memory");
-        return ERROR_OUT_OF_MEMORY;
-    }
+        Point start = { 0, 0 };
 
-    for (int col = 0; col < p_table->content[row]->idx; col++)
-    {
-        for (int dir_idx = dir_range[0]; dir_idx < dir_range[1]; dir_idx++)
-        {
-            if (is_word_found(p_table,
-                              p_word,
-                              row,
-                              col,
-                              coords[dir_idx][0],
-                              coords[dir_idx][1]))
-            {
-                p_loc[0] = col + coords[dir_idx][1]; // x-axis
-                p_loc[1] = row + coords[dir_idx][0]; // y-axis
-                array_add(p_found, p_loc);
-            }
-        }
-    }
-
-    free(p_loc);
-    p_loc = NULL;
-    return ERROR_SUCCESS;
-}
-
-/**
- * @brief Checks if the word is found at the specified row and column.
- *
- * @param p_table Table to check.
- * @param p_word Word to check.
- * @param row Row index.
- * @param col Column index.
- * @param dx Horizontal movement (X direction).
- * @param dy Vertical movement (Y direction).
- *
- * @return true if the word is found, false otherwise.
- */
-bool
-is_word_found (
-    Table *table, const char *p_word, int row, int col, int dx, int dy)
-{
-    if ((NULL == table) || (NULL == p_word))
-    {
-        ERROR_LOG(
-            "Invalid input to is_word_found: one or more inputs are NULL");
-        return false;
-    }
-
-    for (int idx = 0; idx < (int)strlen(p_word); idx++)
-    {
-        int new_row = row + idx * dx;
-        int new_col = col + idx * dy;
+        int_array_reset(&p_work->starts);
+        status = search_row(
+            TABLE_ROW(p_work->p_scratch, diag), p_word, &p_work->starts);
+        table_diagonal_start(
+            p_table->num_rows, width, diag, b_anti, &start.y, &start.x);
 
-        if ((0 > new_row) || (new_row >= table->num_rows) || (0 > new_col)
-            || (new_col >= table->content[new_row]->idx))
+        for (int idx = 0;
+             (ERROR_SUCCESS == status) && (idx < p_work->starts.idx);
+             idx++)
         {
-            return false; // Out of bounds
-        }
+            int   offset = int_array_get(&p_work->starts, idx)
+                         + (int)strlen(p_word) / 2;
+            Point centre = { start.x + step * offset, start.y + offset };
 
-        // Check if the character matches
-        if (((char *)table->content[new_row]->list[new_col])[0] != p_word[idx])
-        {
-            return false; // Character does not match
+            status = point_array_push(&p_work->found, centre);
         }
     }
 
-    return true; // All characters matched
+    return status;
 }
 
 /**
@@ -497,7 +461,7 @@ is_word_found (
  * @return The count of overlapping coordinates.
  */
 static int
-count_overlaps (Array *p_array)
+count_overlaps (const PointArray *p_array)
 {
     int word_count = 0;
 
@@ -507,32 +471,14 @@ count_overlaps (Array *p_array)
         return word_count;
     }
 
+    const Point *coords = p_array->data;
+
     for (int idx = 0; idx < p_array->idx; idx++)
     {
-        const int *coord_one = (const int *)p_array->list[idx];
-
-        if (NULL == coord_one)
-        {
-            ERROR_LOG(
-                "Failed type casting and dereferencing element: Null pointer "
-                "detected in list");
-            continue;
-        }
-
         for (int jdx = idx + 1; jdx < p_array->idx; jdx++)
         {
-            const int *coord_two = (const int *)p_array->list[jdx];
-
-            if (NULL == coord_two)
-            {
-                ERROR_LOG(
-                    "Failed type casting and dereferencing element: Null "
-                    "pointer detected in list");
-                continue;
-            }
-
-            if ((coord_one[0] == coord_two[0])
-                && (coord_one[1] == coord_two[1]))
+            if ((coords[idx].x == coords[jdx].x)
+                && (coords[idx].y == coords[jdx].y))
             {
                 word_count++;
             }
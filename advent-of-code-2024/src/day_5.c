@@ -1,12 +1,13 @@
 #include "array.h"
 #include "aux.h"
+#include "bitmatrix.h"
+#include "cursor.h"
 #include "day_5.h"
 #include "error.h"
-#include "graph.h"
+#include "input.h"
 
-#include <stdio.h>
+#include <stdbool.h>
 #include <stdlib.h>
-#include <string.h>
 
 /**
  * @file day_5.c
@@ -15,16 +16,25 @@
 
 #define DIGITS_CAP 2
 
+/* Page numbers are two-digit ids */
+#define PAGE_ID_LIMIT 100
+
 /* Function Prototypes */
-Array *extract_digits(char *p_line, const char *p_delimiter);
+static int  extract_digits(Span line, char delimiter, Array *p_digits);
+static bool b_is_ordered(const BitMatrix *p_rules, const Array *p_update);
+static int  compare_pages(const void *lhs, const void *rhs, void *ctx);
 
 int
 day_5 (const char *filename, int result[2])
 {
-    FILE *p_file            = NULL;
-    char  line[BUFFER_SIZE] = { 0 };
-    int   status            = ERROR_UNKNOWN;
-    Graph *p_graph = NULL;
+    Input     *p_input = NULL;
+    int        status  = ERROR_UNKNOWN;
+    BitMatrix *p_rules = NULL;
+    Array      digits;
+    Array     *p_digits = &digits;
+
+    // Rules hold two integers, which stay in the inline buffer
+    array_init(p_digits, TYPE_INT);
 
     if ((NULL == filename) || (NULL == result))
     {
@@ -33,123 +43,264 @@ day_5 (const char *filename, int result[2])
         goto EXIT;
     }
 
-    p_file = fopen(filename, "r");
+    p_input = input_open_stream(filename);
 
-    if (NULL == p_file)
+    if (NULL == p_input)
     {
-        ERROR_LOG("Failed fopen: file not found");
+        ERROR_LOG("Failed input_open_stream: file not found");
         status = ERROR_FILE_NOT_FOUND;
         goto EXIT;
     }
 
-    p_graph = graph_initialization();
+    p_rules = bitmatrix_initialization(PAGE_ID_LIMIT, PAGE_ID_LIMIT);
 
-    if (NULL == p_graph)
+    if (NULL == p_rules)
     {
-        ERROR_LOG("Failed graph_initialization: unable to allocate memory");
+        ERROR_LOG("Failed bitmatrix_initialization: unable to allocate memory");
         status = ERROR_OUT_OF_MEMORY;
         goto EXIT;
     }
 
-    int sum_one = 0;
-    int sum_two = 0;
+    int  sum_one = 0;
+    int  sum_two = 0;
+    Span line;
 
-    while (NULL != fgets(line, sizeof(line), p_file))
+    // Each rule "X|Y" sets bit (X, Y): X must be printed before Y
+    while (true == input_next_line(p_input, &line))
     {
         // Separator of rules and updates
-        if (0 == strncmp(line, "\n", sizeof(line)))
+        if (0 == line.len)
         {
             break;
         }
 
         // Split the integers from the line
-        Array *p_rules = extract_digits(line, "|");
+        status = extract_digits(line, '|', p_digits);
 
-        printf("(");
-        array_print(p_rules);
-        printf(")\n");
+        if (ERROR_SUCCESS != status)
+        {
+            ERROR_LOG("Failed extract_digits: unable to parse rule");
+            goto EXIT;
+        }
 
-        if (DIGITS_CAP != p_rules->idx)
+        if (DIGITS_CAP != p_digits->idx)
         {
-            ERROR_LOG("Failed extract_digits: incorrect number of integers parsed");
+            ERROR_LOG(
+                "Failed extract_digits: incorrect number of integers parsed");
+            status = ERROR_INVALID_INPUT;
+            goto EXIT;
         }
-        else
+
+        status = bitmatrix_set(p_rules,
+                               ARRAY_AT(p_digits, int, 0),
+                               ARRAY_AT(p_digits, int, 1));
+
+        if (ERROR_SUCCESS != status)
+        {
+            ERROR_LOG("Failed bitmatrix_set: unable to store rule");
+            goto EXIT;
+        }
+    }
+
+    while (true == input_next_line(p_input, &line))
+    {
+        status = extract_digits(line, ',', p_digits);
+
+        if (ERROR_SUCCESS != status)
+        {
+            ERROR_LOG("Failed extract_digits: unable to parse update");
+            goto EXIT;
+        }
+
+        if (0 == p_digits->idx)
         {
-            // graph_add_edge(p_graph, *(int *)p_rules->list[0], *(int *)p_rules->list[1]); // should resize itself
+            continue;
         }
 
-        array_destroy(p_rules);
+        // Rules are only indexed by page ids below the limit
+        for (int idx = 0; idx < p_digits->idx; idx++)
+        {
+            int page = ARRAY_AT(p_digits, int, idx);
+
+            if ((0 > page) || (PAGE_ID_LIMIT <= page))
+            {
+                ERROR_LOG("Failed extract_digits: page id out of range");
+                status = ERROR_INDEX_OUT_OF_BOUNDS;
+                goto EXIT;
+            }
+        }
+
+        if (b_is_ordered(p_rules, p_digits))
+        {
+            sum_one += ARRAY_AT(p_digits, int, p_digits->idx / 2);
+            continue;
+        }
+
+        // Only rules between pages of this update matter, so a comparison
+        // sort restricted to them is immune to cycles in the full rule set
+        status = array_sort_stable_ctx(p_digits, compare_pages, p_rules);
+
+        if (ERROR_SUCCESS != status)
+        {
+            ERROR_LOG("Failed array_sort_stable_ctx: unable to reorder update");
+            goto EXIT;
+        }
+
+        // The comparator is only a total order when the rules relate every
+        // pair of pages in the update; otherwise the sort may leave it wrong
+        if (false == b_is_ordered(p_rules, p_digits))
+        {
+            ERROR_LOG("Invalid input to day_5: rules do not order the update");
+            status = ERROR_INVALID_INPUT;
+            goto EXIT;
+        }
+
+        sum_two += ARRAY_AT(p_digits, int, p_digits->idx / 2);
     }
 
-    // graph_sort(p_graph);
     result[0] = sum_one;
     result[1] = sum_two;
-    status    = ERROR_SUCCESS;
+    status    = p_input->status;
 
 EXIT:
-    if (NULL != p_file)
+    input_close(p_input);
+    bitmatrix_destroy(p_rules);
+    array_release(p_digits);
+    return status;
+}
+
+/**
+ * @brief Checks whether an update respects every applicable rule.
+ *
+ * The rules as a whole may contain cycles, so the check is made pair by
+ * pair: an update is out of order if some page has a rule requiring it to
+ * precede a page printed before it. Each pair costs one bit test.
+ *
+ * @param p_rules  Pointer to the rule matrix; every page must be a valid
+ * index.
+ * @param p_update Pointer to the pages of the update, in print order.
+ *
+ * @return `true` if the update is correctly ordered, `false` otherwise.
+ */
+static bool
+b_is_ordered (const BitMatrix *p_rules, const Array *p_update)
+{
+    for (int later = 1; later < p_update->idx; later++)
     {
-        fclose(p_file);
-        p_file = NULL;
+        for (int earlier = 0; earlier < later; earlier++)
+        {
+            if (BITMATRIX_TEST(p_rules,
+                               ARRAY_AT(p_update, int, later),
+                               ARRAY_AT(p_update, int, earlier)))
+            {
+                return false;
+            }
+        }
     }
 
-    graph_destroy(p_graph);
-    return status;
+    return true;
 }
 
 /**
- * @brief Extracts integers from a delimited string and stores them in an Array.
+ * @brief Orders two pages according to the rules.
  *
- * @param p_line Pointer to a null-terminated string containing integers
- * separated by a delimiter.
- * @param p_delimiter Pointer to a null-terminated string containing a
- * delimiter.
+ * @param lhs Pointer to the first page id.
+ * @param rhs Pointer to the second page id.
+ * @param ctx Pointer to the rule BitMatrix.
  *
- * @return Pointer to an Array containing the extracted integers, or NULL on
- *         failure.
+ * Pages with no rule between them compare equal, which is not transitive,
+ * so a sort only yields a valid order when every pair is related.
  *
- * @warning The caller is responsible for freeing the returned Array using
- *       `array_destroy`.
+ * @return A negative value if a rule puts `lhs` first, a positive value if a
+ * rule puts `rhs` first, and zero if no rule relates them.
  */
-Array *
-extract_digits (char *p_line, const char *p_delimiter)
+static int
+compare_pages (const void *lhs, const void *rhs, void *ctx)
 {
-    Array *p_digits = NULL;
+    const BitMatrix *p_rules = ctx;
+    int              left    = *(const int *)lhs;
+    int              right   = *(const int *)rhs;
 
-    if ((NULL == p_line) || (NULL == p_delimiter))
+    if (BITMATRIX_TEST(p_rules, left, right))
+    {
+        return -1;
+    }
+
+    return BITMATRIX_TEST(p_rules, right, left) ? 1 : 0;
+}
+
+/**
+ * @brief Extracts integers from a delimited line and stores them in an Array.
+ *
+ * The Array is reset first, so the same (typically stack-allocated) Array can
+ * be reused for every line without allocating. Empty fields are skipped.
+ *
+ * @param line      Line of text containing integers separated by a delimiter.
+ * @param delimiter Character separating the integers.
+ * @param p_digits  Pointer to the integer Array that receives the values.
+ *
+ * @return ERROR_SUCCESS on success, or an appropriate error code on failure.
+ */
+static int
+extract_digits (Span line, char delimiter, Array *p_digits)
+{
+    int status = ERROR_UNKNOWN;
+
+    if ((NULL == line.data) || (NULL == p_digits))
     {
         ERROR_LOG(
             "Invalid input to extract_digits: one or more inputs are NULL.");
+        status = ERROR_NULL_POINTER;
         goto EXIT;
     }
 
-    p_digits = array_initialization(TYPE_INT);
+    status = array_reset(p_digits);
 
-    if (NULL == p_digits)
+    if (ERROR_SUCCESS != status)
     {
-        ERROR_LOG("Failed array_initialization: unable to initialize array.");
+        ERROR_LOG("Failed array_reset: unable to reset array.");
         goto EXIT;
     }
 
-    char *token = strtok(p_line, p_delimiter);
+    Cursor fields = cursor_from_span(line);
+    Span   field;
 
-    while (NULL != token)
+    while (true == cursor_next_field(&fields, delimiter, &field))
     {
-        int value = atoi(token);
+        Cursor token = cursor_from_span(field);
+        int    value = 0;
+
+        cursor_skip_whitespace(&token);
 
-        if (array_add(p_digits, &value) != ERROR_SUCCESS)
+        if (true == cursor_at_end(&token))
         {
-            ERROR_LOG("Failed array_add: unable to add an integer to array.");
-            array_destroy(p_digits);
-            p_digits = NULL;
+            continue;
+        }
+
+        // The whole field, bar surrounding whitespace, must be the integer
+        if (true == cursor_next_int(&token, &value))
+        {
+            cursor_skip_whitespace(&token);
+        }
+
+        if (false == cursor_at_end(&token))
+        {
+            ERROR_LOG("Failed cursor_next_int: field is not an integer.");
+            status = ERROR_INVALID_INPUT;
             goto EXIT;
         }
 
-        token = strtok(NULL, p_delimiter);
+        status = array_add(p_digits, &value);
+
+        if (ERROR_SUCCESS != status)
+        {
+            ERROR_LOG("Failed array_add: unable to add an integer to array.");
+            goto EXIT;
+        }
     }
 
 EXIT:
-    return p_digits;
+    return status;
 }
 
 /*** end of file ***/
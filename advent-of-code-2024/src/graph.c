@@ -0,0 +1,793 @@
+#include "aux.h"
+#include "error.h"
+#include "graph.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+/**
+ * @file graph.c
+ * @brief Graph functions.
+ *
+ * This file contains functions handle all graph functions. Freezing turns
+ * the edge list into CSR form with a counting sort on the source id: one
+ * pass counts out-degrees, a prefix sum turns them into offsets and a
+ * second pass drops every edge into its slot.
+ *
+ * Dijkstra and A* share one best-first loop over a binary min-heap with
+ * lazy deletion: a node is pushed again whenever its distance improves, and
+ * stale entries are skipped when popped, which avoids a decrease-key
+ * operation and the node-to-slot index it would need.
+ */
+
+/* Function Prototypes */
+static int  graph_search_prepare(GraphSearch       *search,
+                                 const GraphSource *source,
+                                 int                start);
+static int  graph_source_edges(const GraphSource *source,
+                               int                node,
+                               int               *buffer,
+                               int               *weight_buffer,
+                               const int        **successors,
+                               const int        **weights);
+static int  graph_heap_insert(GraphHeap *heap, long long key, int node);
+static void graph_heap_pop(GraphHeap *heap, GraphHeapEntry *top);
+static int  graph_best_first(GraphSearch       *search,
+                             const GraphSource *source,
+                             int                start,
+                             int                goal,
+                             GraphHeuristicFn   heuristic,
+                             void              *ctx);
+
+/**
+ * @brief Sizes a search state for a source and resets it for a new search.
+ *
+ * @param search Pointer to the search state.
+ * @param source Pointer to the graph about to be searched.
+ * @param start  Id of the start node.
+ * @return ERROR_SUCCESS on success, or an appropriate error code on failure.
+ */
+static int
+graph_search_prepare (GraphSearch *search, const GraphSource *source, int start)
+{
+    if ((NULL == search) || (NULL == source))
+    {
+        ERROR_LOG("Invalid input to graph search: one or more inputs are NULL");
+        return ERROR_NULL_POINTER;
+    }
+
+    if (((NULL == source->graph) && (NULL == source->neighbours))
+        || ((NULL != source->graph) && (false == source->graph->b_frozen))
+        || (0 > start) || (source->num_nodes <= start))
+    {
+        ERROR_LOG("Invalid input to graph search: bad source or start node");
+        return ERROR_INVALID_INPUT;
+    }
+
+    if (source->num_nodes > search->capacity)
+    {
+        size_t     num_nodes = (size_t)source->num_nodes;
+        long long *dist      = realloc(search->dist,
+                                  num_nodes * sizeof(long long));
+
+        if (NULL != dist)
+        {
+            search->dist = dist;
+        }
+
+        int       *parent  = realloc(search->parent, num_nodes * sizeof(int));
+        BitMatrix *visited = bitmatrix_initialization(1, source->num_nodes);
+
+        if (NULL != parent)
+        {
+            search->parent = parent;
+        }
+
+        if ((NULL == dist) || (NULL == parent) || (NULL == visited))
+        {
+            ERROR_LOG("Failed to allocate memory for graph search");
+            bitmatrix_destroy(visited);
+            return ERROR_OUT_OF_MEMORY;
+        }
+
+        bitmatrix_destroy(search->visited);
+        search->visited  = visited;
+        search->capacity = source->num_nodes;
+    }
+
+    for (int node = 0; node < source->num_nodes; node++)
+    {
+        search->dist[node]   = GRAPH_UNREACHABLE;
+        search->parent[node] = -1;
+    }
+
+    // Sized to this source, so the visited bounds checks stop at its nodes
+    int return_status = bitmatrix_resize(search->visited, 1, source->num_nodes);
+
+    if (ERROR_SUCCESS != return_status)
+    {
+        ERROR_LOG("Failed bitmatrix_resize: unable to size visited set");
+        return return_status;
+    }
+
+    search->num_nodes = source->num_nodes;
+    int_array_reset(&search->frontier);
+    graph_heap_reset(&search->heap);
+    return ERROR_SUCCESS;
+}
+
+/**
+ * @brief Lists the out-edges of a node of either kind of source.
+ *
+ * A frozen graph hands out its CSR rows directly; an implicit graph writes
+ * into the caller's buffers, which hold `GRAPH_MAX_IMPLICIT_DEGREE` entries.
+ *
+ * @param source        Pointer to the graph.
+ * @param node          Id of the node.
+ * @param buffer        Scratch space for implicit successor ids.
+ * @param weight_buffer Scratch space for implicit edge weights.
+ * @param successors    Output for the successor ids.
+ * @param weights       Output for the edge weights.
+ * @return The number of edges, or -1 if the callback misbehaved.
+ */
+static int
+graph_source_edges (const GraphSource *source,
+                    int                node,
+                    int               *buffer,
+                    int               *weight_buffer,
+                    const int        **successors,
+                    const int        **weights)
+{
+    if (NULL != source->graph)
+    {
+        const Graph *graph = source->graph;
+
+        *successors = graph->targets + graph->offsets[node];
+        *weights    = graph->weights + graph->offsets[node];
+        return graph->offsets[node + 1] - graph->offsets[node];
+    }
+
+    int count = source->neighbours(node, buffer, weight_buffer, source->ctx);
+
+    *successors = buffer;
+    *weights    = weight_buffer;
+
+    if ((0 > count) || (GRAPH_MAX_IMPLICIT_DEGREE < count))
+    {
+        return -1;
+    }
+
+    for (int idx = 0; idx < count; idx++)
+    {
+        if ((0 > buffer[idx]) || (source->num_nodes <= buffer[idx])
+            || (0 > weight_buffer[idx]))
+        {
+            return -1;
+        }
+    }
+
+    return count;
+}
+
+/**
+ * @brief Inserts an entry into a binary min-heap.
+ *
+ * @param heap Pointer to the heap.
+ * @param key  Priority of the entry.
+ * @param node Id of the node.
+ * @return ERROR_SUCCESS on success, or an appropriate error code on failure.
+ */
+static int
+graph_heap_insert (GraphHeap *heap, long long key, int node)
+{
+    GraphHeapEntry entry = { key, node };
+
+    if (ERROR_SUCCESS != graph_heap_push(heap, entry))
+    {
+        return ERROR_OUT_OF_MEMORY;
+    }
+
+    // Sift the new entry up past every parent with a larger key
+    int idx = heap->idx - 1;
+
+    while (0 < idx)
+    {
+        int up = (idx - 1) / 2;
+
+        if (heap->data[up].key <= key)
+        {
+            break;
+        }
+
+        heap->data[idx] = heap->data[up];
+        idx             = up;
+    }
+
+    heap->data[idx] = entry;
+    return ERROR_SUCCESS;
+}
+
+/**
+ * @brief Removes the entry with the smallest key from a non-empty heap.
+ *
+ * @param heap Pointer to the heap.
+ * @param top  Output for the removed entry.
+ */
+static void
+graph_heap_pop (GraphHeap *heap, GraphHeapEntry *top)
+{
+    *top = heap->data[0];
+
+    GraphHeapEntry last = heap->data[--heap->idx];
+    int            idx  = 0;
+
+    // Sift the last entry down from the root into the hole
+    for (;;)
+    {
+        int child = 2 * idx + 1;
+
+        if (child >= heap->idx)
+        {
+            break;
+        }
+
+        if ((child + 1 < heap->idx)
+            && (heap->data[child + 1].key < heap->data[child].key))
+        {
+            child++;
+        }
+
+        if (last.key <= heap->data[child].key)
+        {
+            break;
+        }
+
+        heap->data[idx] = heap->data[child];
+        idx             = child;
+    }
+
+    if (0 < heap->idx)
+    {
+        heap->data[idx] = last;
+    }
+}
+
+/**
+ * @brief Runs Dijkstra's algorithm, or A* when a heuristic is given.
+ *
+ * @param search    Pointer to the search state receiving the results.
+ * @param source    Pointer to the graph to search.
+ * @param start     Id of the start node.
+ * @param goal      Id of the node at which to stop, or -1.
+ * @param heuristic Callback estimating the distance to `goal`, or NULL.
+ * @param ctx       Context passed to `heuristic`.
+ * @return ERROR_SUCCESS on success, or an appropriate error code on failure.
+ */
+static int
+graph_best_first (GraphSearch       *search,
+                  const GraphSource *source,
+                  int                start,
+                  int                goal,
+                  GraphHeuristicFn   heuristic,
+                  void              *ctx)
+{
+    int return_status = graph_search_prepare(search, source, start);
+
+    if (ERROR_SUCCESS != return_status)
+    {
+        goto EXIT;
+    }
+
+    if ((-1 > goal) || (source->num_nodes <= goal))
+    {
+        ERROR_LOG("Invalid input to graph search: bad goal node");
+        return_status = ERROR_INVALID_INPUT;
+        goto EXIT;
+    }
+
+    int        buffer[GRAPH_MAX_IMPLICIT_DEGREE];
+    int        weight_buffer[GRAPH_MAX_IMPLICIT_DEGREE];
+    long long  h_start = (NULL != heuristic) ? heuristic(start, goal, ctx) : 0;
+    BitMatrix *visited = search->visited;
+
+    search->dist[start] = 0;
+    return_status       = graph_heap_insert(&search->heap, h_start, start);
+
+    while ((ERROR_SUCCESS == return_status) && (0 < search->heap.idx))
+    {
+        GraphHeapEntry top;
+
+        graph_heap_pop(&search->heap, &top);
+
+        // Entries left behind by a later improvement are stale
+        if (true == BITMATRIX_TEST(visited, 0, top.node))
+        {
+            continue;
+        }
+
+        bitmatrix_set(visited, 0, top.node);
+
+        if (goal == top.node)
+        {
+            break;
+        }
+
+        const int *successors = NULL;
+        const int *weights    = NULL;
+        int        count      = graph_source_edges(
+            source, top.node, buffer, weight_buffer, &successors, &weights);
+
+        if (0 > count)
+        {
+            ERROR_LOG("Invalid implicit graph edge: bad successor or weight");
+            return_status = ERROR_INVALID_INPUT;
+            goto EXIT;
+        }
+
+        for (int idx = 0; idx < count; idx++)
+        {
+            int       next = successors[idx];
+            long long dist = search->dist[top.node] + weights[idx];
+
+            if ((true == BITMATRIX_TEST(visited, 0, next))
+                || (dist >= search->dist[next]))
+            {
+                continue;
+            }
+
+            long long key = dist;
+
+            if (NULL != heuristic)
+            {
+                key += heuristic(next, goal, ctx);
+            }
+
+            search->dist[next]   = dist;
+            search->parent[next] = top.node;
+            return_status = graph_heap_insert(&search->heap, key, next);
+
+            if (ERROR_SUCCESS != return_status)
+            {
+                break;
+            }
+        }
+    }
+
+EXIT:
+    return return_status;
+}
+
+Graph *
+graph_initialization (void)
+{
+    Graph *graph = calloc(1, sizeof(Graph));
+
+    if (NULL == graph)
+    {
+        ERROR_LOG("Failed calloc: unable to allocate memory");
+        return NULL;
+    }
+
+    int_array_init(&graph->edge_from);
+    int_array_init(&graph->edge_to);
+    int_array_init(&graph->edge_weight);
+    return graph;
+}
+
+void
+graph_destroy (Graph *graph)
+{
+    if (NULL != graph)
+    {
+        int_array_destroy(&graph->edge_from);
+        int_array_destroy(&graph->edge_to);
+        int_array_destroy(&graph->edge_weight);
+        free(graph->offsets);
+        free(graph->targets);
+        free(graph->weights);
+        graph->offsets = NULL;
+        graph->targets = NULL;
+        graph->weights = NULL;
+
+        free(graph);
+        graph = NULL;
+    }
+}
+
+int
+graph_add_edge (Graph *graph, int from, int to)
+{
+    return graph_add_weighted_edge(graph, from, to, 1);
+}
+
+int
+graph_add_weighted_edge (Graph *graph, int from, int to, int weight)
+{
+    if (NULL == graph)
+    {
+        ERROR_LOG("Invalid input to graph_add_weighted_edge: input is NULL");
+        return ERROR_NULL_POINTER;
+    }
+
+    if ((0 > from) || (0 > to) || (0 > weight) || (true == graph->b_frozen))
+    {
+        ERROR_LOG(
+            "Invalid input to graph_add_weighted_edge: bad edge or frozen "
+            "graph");
+        return ERROR_INVALID_INPUT;
+    }
+
+    if ((ERROR_SUCCESS != int_array_push(&graph->edge_from, from))
+        || (ERROR_SUCCESS != int_array_push(&graph->edge_to, to))
+        || (ERROR_SUCCESS != int_array_push(&graph->edge_weight, weight)))
+    {
+        ERROR_LOG("Failed int_array_push: unable to store edge");
+        return ERROR_OUT_OF_MEMORY;
+    }
+
+    int largest = (from > to) ? from : to;
+
+    graph->num_nodes = (largest >= graph->num_nodes) ? largest + 1
+                                                     : graph->num_nodes;
+    graph->num_edges++;
+    return ERROR_SUCCESS;
+}
+
+int
+graph_freeze (Graph *graph)
+{
+    int  return_status = ERROR_NULL_POINTER;
+    int *cursor        = NULL;
+
+    if (NULL == graph)
+    {
+        ERROR_LOG("Invalid input to graph_freeze: input is NULL");
+        goto EXIT;
+    }
+
+    if (true == graph->b_frozen)
+    {
+        return_status = ERROR_SUCCESS;
+        goto EXIT;
+    }
+
+    size_t num_rows  = (size_t)graph->num_nodes + 1;
+    size_t num_slots = (size_t)graph->num_edges + 1;
+
+    graph->offsets = calloc(num_rows, sizeof(int));
+    graph->targets = malloc(num_slots * sizeof(int));
+    graph->weights = malloc(num_slots * sizeof(int));
+    cursor         = malloc(num_rows * sizeof(int));
+
+    if ((NULL == graph->offsets) || (NULL == graph->targets)
+        || (NULL == graph->weights) || (NULL == cursor))
+    {
+        ERROR_LOG("Failed to allocate memory for graph adjacency");
+        free(graph->offsets);
+        free(graph->targets);
+        free(graph->weights);
+        graph->offsets = NULL;
+        graph->targets = NULL;
+        graph->weights = NULL;
+        return_status  = ERROR_OUT_OF_MEMORY;
+        goto EXIT;
+    }
+
+    const int *from   = graph->edge_from.data;
+    const int *to     = graph->edge_to.data;
+    const int *weight = graph->edge_weight.data;
+
+    // offsets[n + 1] counts the out-degree of n, then becomes n's end
+    for (int edge = 0; edge < graph->num_edges; edge++)
+    {
+        graph->offsets[from[edge] + 1]++;
+    }
+
+    for (int node = 0; node < graph->num_nodes; node++)
+    {
+        graph->offsets[node + 1] += graph->offsets[node];
+    }
+
+    // Fill each row through a cursor so edges keep their insertion order
+    memcpy(cursor, graph->offsets, (size_t)graph->num_nodes * sizeof(int));
+
+    for (int edge = 0; edge < graph->num_edges; edge++)
+    {
+        int slot = cursor[from[edge]]++;
+
+        graph->targets[slot] = to[edge];
+        graph->weights[slot] = weight[edge];
+    }
+
+    int_array_destroy(&graph->edge_from);
+    int_array_destroy(&graph->edge_to);
+    int_array_destroy(&graph->edge_weight);
+    graph->b_frozen = true;
+    return_status   = ERROR_SUCCESS;
+
+EXIT:
+    free(cursor);
+    return return_status;
+}
+
+const int *
+graph_neighbours (const Graph *graph, int node, int *count)
+{
+    if (NULL != count)
+    {
+        *count = 0;
+    }
+
+    if ((NULL == graph) || (NULL == count) || (false == graph->b_frozen)
+        || (0 > node) || (graph->num_nodes <= node))
+    {
+        return NULL;
+    }
+
+    *count = graph->offsets[node + 1] - graph->offsets[node];
+    return graph->targets + graph->offsets[node];
+}
+
+bool
+graph_has_edge (const Graph *graph, int from, int to)
+{
+    int        count      = 0;
+    const int *successors = graph_neighbours(graph, from, &count);
+
+    for (int idx = 0; idx < count; idx++)
+    {
+        if (to == successors[idx])
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+int
+graph_topological_sort (const Graph *graph, Array *order)
+{
+    int  return_status = ERROR_NULL_POINTER;
+    int *in_degree     = NULL;
+
+    if ((NULL == graph) || (NULL == order))
+    {
+        ERROR_LOG(
+            "Invalid input to graph_topological_sort: one or more inputs are "
+            "NULL");
+        goto EXIT;
+    }
+
+    if ((false == graph->b_frozen) || (TYPE_INT != order->ele_type))
+    {
+        ERROR_LOG(
+            "Invalid input to graph_topological_sort: graph must be frozen "
+            "and order TYPE_INT");
+        return_status = ERROR_INVALID_INPUT;
+        goto EXIT;
+    }
+
+    return_status = array_reset(order);
+
+    if (ERROR_SUCCESS == return_status)
+    {
+        return_status = array_reserve(order, graph->num_nodes);
+    }
+
+    in_degree = calloc((size_t)graph->num_nodes + 1, sizeof(int));
+
+    if ((ERROR_SUCCESS != return_status) || (NULL == in_degree))
+    {
+        ERROR_LOG("Failed to allocate memory for topological sort");
+        return_status = ERROR_OUT_OF_MEMORY;
+        goto EXIT;
+    }
+
+    for (int edge = 0; edge < graph->num_edges; edge++)
+    {
+        in_degree[graph->targets[edge]]++;
+    }
+
+    // The output doubles as the FIFO queue: [head, tail) are ready nodes
+    int *queue = order->data;
+    int  tail  = 0;
+
+    for (int node = 0; node < graph->num_nodes; node++)
+    {
+        if (0 == in_degree[node])
+        {
+            queue[tail++] = node;
+        }
+    }
+
+    for (int head = 0; head < tail; head++)
+    {
+        int node = queue[head];
+
+        for (int edge = graph->offsets[node]; edge < graph->offsets[node + 1];
+             edge++)
+        {
+            if (0 == --in_degree[graph->targets[edge]])
+            {
+                queue[tail++] = graph->targets[edge];
+            }
+        }
+    }
+
+    order->idx    = tail;
+    return_status = (tail == graph->num_nodes) ? ERROR_SUCCESS
+                                               : ERROR_CYCLE_DETECTED;
+
+EXIT:
+    free(in_degree);
+    return return_status;
+}
+
+GraphSource
+graph_source_csr (const Graph *graph)
+{
+    GraphSource source = { 0 };
+
+    source.graph     = graph;
+    source.num_nodes = (NULL != graph) ? graph->num_nodes : 0;
+    return source;
+}
+
+GraphSource
+graph_source_grid (int              width,
+                   int              height,
+                   GraphNeighbourFn neighbours,
+                   void            *ctx)
+{
+    GraphSource source = { 0 };
+
+    if ((0 < width) && (0 < height) && (INT_MAX / width >= height))
+    {
+        source.neighbours = neighbours;
+        source.ctx        = ctx;
+        source.num_nodes  = width * height;
+        source.width      = width;
+        source.height     = height;
+    }
+
+    return source;
+}
+
+GraphSearch *
+graph_search_initialization (void)
+{
+    GraphSearch *search = calloc(1, sizeof(GraphSearch));
+
+    if (NULL == search)
+    {
+        ERROR_LOG("Failed calloc: unable to allocate memory");
+        return NULL;
+    }
+
+    int_array_init(&search->frontier);
+    graph_heap_init(&search->heap);
+    return search;
+}
+
+void
+graph_search_destroy (GraphSearch *search)
+{
+    if (NULL != search)
+    {
+        free(search->dist);
+        free(search->parent);
+        bitmatrix_destroy(search->visited);
+        int_array_destroy(&search->frontier);
+        graph_heap_destroy(&search->heap);
+        search->dist    = NULL;
+        search->parent  = NULL;
+        search->visited = NULL;
+
+        free(search);
+        search = NULL;
+    }
+}
+
+int
+graph_bfs (GraphSearch *search, const GraphSource *source, int start)
+{
+    int return_status = graph_search_prepare(search, source, start);
+
+    if (ERROR_SUCCESS != return_status)
+    {
+        goto EXIT;
+    }
+
+    int       buffer[GRAPH_MAX_IMPLICIT_DEGREE];
+    int       weight_buffer[GRAPH_MAX_IMPLICIT_DEGREE];
+    IntArray *queue = &search->frontier;
+
+    // A node is marked when first queued, so dist doubles as the hop count
+    search->dist[start] = 0;
+    bitmatrix_set(search->visited, 0, start);
+    return_status = int_array_push(queue, start);
+
+    for (int head = 0; (ERROR_SUCCESS == return_status) && (head < queue->idx);
+         head++)
+    {
+        int        node       = queue->data[head];
+        const int *successors = NULL;
+        const int *weights    = NULL;
+        int        count      = graph_source_edges(
+            source, node, buffer, weight_buffer, &successors, &weights);
+
+        if (0 > count)
+        {
+            ERROR_LOG("Invalid implicit graph edge: bad successor or weight");
+            return_status = ERROR_INVALID_INPUT;
+            goto EXIT;
+        }
+
+        for (int idx = 0; idx < count; idx++)
+        {
+            int next = successors[idx];
+
+            if (true == BITMATRIX_TEST(search->visited, 0, next))
+            {
+                continue;
+            }
+
+            bitmatrix_set(search->visited, 0, next);
+            search->dist[next]   = search->dist[node] + 1;
+            search->parent[next] = node;
+            return_status        = int_array_push(queue, next);
+
+            if (ERROR_SUCCESS != return_status)
+            {
+                break;
+            }
+        }
+    }
+
+EXIT:
+    return return_status;
+}
+
+int
+graph_dijkstra (GraphSearch       *search,
+                const GraphSource *source,
+                int                start,
+                int                goal)
+{
+    return graph_best_first(search, source, start, goal, NULL, NULL);
+}
+
+int
+graph_astar (GraphSearch       *search,
+             const GraphSource *source,
+             int                start,
+             int                goal,
+             GraphHeuristicFn   heuristic,
+             void              *ctx)
+{
+    if (NULL == heuristic)
+    {
+        ERROR_LOG("Invalid input to graph_astar: heuristic is NULL");
+        return ERROR_NULL_POINTER;
+    }
+
+    if (0 > goal)
+    {
+        ERROR_LOG("Invalid input to graph_astar: bad goal node");
+        return ERROR_INVALID_INPUT;
+    }
+
+    int return_status
+        = graph_best_first(search, source, start, goal, heuristic, ctx);
+
+    if ((ERROR_SUCCESS == return_status)
+        && (GRAPH_UNREACHABLE == search->dist[goal]))
+    {
+        return_status = ERROR_ELEMENT_NOT_FOUND;
+    }
+
+    return return_status;
+}
+
+/*** end of file ***/
@@ -0,0 +1,172 @@
+#include "aux.h"
+#include "error.h"
+#include "grid.h"
+#include "input.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+/**
+ * @file grid.c
+ * @brief Grid functions.
+ *
+ * This file contains functions handle all grid functions. The cells and
+ * their sentinel border live in one allocation, row after row, so a scan
+ * walks memory sequentially.
+ */
+
+/* Function Prototypes */
+static size_t grid_line_length(const char *line, size_t len);
+
+/**
+ * @brief Returns the length of a line, excluding any `\r` before its end.
+ *
+ * @param line Pointer to the start of the line.
+ * @param len  Length of the line, excluding the newline.
+ * @return The length of the line's content.
+ */
+static size_t
+grid_line_length (const char *line, size_t len)
+{
+    return ((0 < len) && ('\r' == line[len - 1])) ? len - 1 : len;
+}
+
+Grid *
+grid_initialization (int width, int height, int pad, char sentinel)
+{
+    Grid *grid = NULL;
+
+    if ((0 > width) || (0 > height) || (0 > pad))
+    {
+        ERROR_LOG("Invalid input to grid_initialization: negative dimension");
+        goto EXIT;
+    }
+
+    grid = malloc(sizeof(Grid));
+
+    if (NULL == grid)
+    {
+        ERROR_LOG("Failed malloc: unable to allocate memory");
+        goto EXIT;
+    }
+
+    grid->width    = width;
+    grid->height   = height;
+    grid->pad      = pad;
+    grid->stride   = width + 2 * pad;
+    grid->sentinel = sentinel;
+
+    size_t num_cells = (size_t)grid->stride * (size_t)(height + 2 * pad);
+
+    // Never ask malloc for zero bytes so an empty grid is still valid
+    grid->cells = malloc((0 < num_cells) ? num_cells : 1);
+
+    if (NULL == grid->cells)
+    {
+        ERROR_LOG("Failed malloc: unable to allocate memory");
+        free(grid);
+        grid = NULL;
+        goto EXIT;
+    }
+
+    memset(grid->cells, sentinel, num_cells);
+
+EXIT:
+    return grid;
+}
+
+Grid *
+grid_from_buffer (const char *buffer, size_t len, int pad, char sentinel)
+{
+    Grid *grid   = NULL;
+    int   width  = 0;
+    int   height = 0;
+
+    if (NULL == buffer)
+    {
+        ERROR_LOG("Invalid input to grid_from_buffer: input is NULL");
+        goto EXIT;
+    }
+
+    // First pass sizes the grid, second pass copies each line into place
+    for (size_t pos = 0; pos < len; height++)
+    {
+        const char *line = buffer + pos;
+        const char *end  = memchr(line, '\n', len - pos);
+        size_t      span = (NULL != end) ? (size_t)(end - line) : len - pos;
+        size_t      size = grid_line_length(line, span);
+
+        width = ((size_t)width < size) ? (int)size : width;
+        pos += span + 1;
+    }
+
+    grid = grid_initialization(width, height, pad, sentinel);
+
+    if (NULL == grid)
+    {
+        goto EXIT;
+    }
+
+    size_t pos = 0;
+
+    for (int row = 0; row < height; row++)
+    {
+        const char *line = buffer + pos;
+        const char *end  = memchr(line, '\n', len - pos);
+        size_t      span = (NULL != end) ? (size_t)(end - line) : len - pos;
+
+        memcpy(&GRID_AT(grid, row, 0), line, grid_line_length(line, span));
+        pos += span + 1;
+    }
+
+EXIT:
+    return grid;
+}
+
+Grid *
+grid_load (const char *filename, int pad, char sentinel)
+{
+    Grid  *grid    = NULL;
+    Input *p_input = NULL;
+
+    if (NULL == filename)
+    {
+        ERROR_LOG("Invalid input to grid_load: input is NULL");
+        goto EXIT;
+    }
+
+    p_input = input_open(filename);
+
+    if (NULL == p_input)
+    {
+        ERROR_LOG("Failed input_open: file not found");
+        goto EXIT;
+    }
+
+    grid = grid_from_buffer(p_input->data, p_input->size, pad, sentinel);
+
+EXIT:
+    input_close(p_input);
+    return grid;
+}
+
+ptrdiff_t
+grid_offset (const Grid *grid, int drow, int dcol)
+{
+    return (ptrdiff_t)drow * grid->stride + dcol;
+}
+
+void
+grid_destroy (Grid *grid)
+{
+    if (NULL != grid)
+    {
+        free(grid->cells);
+        grid->cells = NULL;
+
+        free(grid);
+        grid = NULL;
+    }
+}
+
+/*** end of file ***/
@@ -0,0 +1,217 @@
+#include "aux.h"
+#include "error.h"
+#include "histogram.h"
+#include "kernel.h"
+
+#include <limits.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+/**
+ * @file histogram.c
+ * @brief Histogram functions.
+ *
+ * This file contains functions handle all histogram functions. Values with
+ * a compact range are counted in a dense table; otherwise they go into an
+ * open-addressing hash table with linear probing, sized to at most half
+ * full. Every stored key has a count of at least one, so a zero count
+ * marks an empty hash slot.
+ *
+ * Slots are chosen by Fibonacci hashing: the key is multiplied by 2^32
+ * divided by the golden ratio and the top bits of the product are kept.
+ * The low bits of the product depend only on the low bits of the key, so
+ * masking them would send keys sharing trailing zero bits (e.g. multiples
+ * of 65536) to the same few slots.
+ */
+
+/* Function Prototypes */
+static int histogram_slot(const Histogram *hist, int value);
+static int histogram_fill_dense(Histogram *hist, const int *values, int n);
+static int histogram_fill_hash(Histogram *hist, const int *values, int n);
+
+/**
+ * @brief Finds the hash slot holding a value, or the empty slot ending its
+ * probe sequence.
+ *
+ * @param hist  Pointer to a hash-based histogram.
+ * @param value Value to look up.
+ * @return Index of the slot.
+ */
+static int
+histogram_slot (const Histogram *hist, int value)
+{
+    uint32_t mask = (uint32_t)hist->capacity - 1;
+    uint32_t slot = ((uint32_t)value * 2654435761u) >> hist->shift;
+
+    while ((0 != hist->counts[slot]) && (value != hist->keys[slot]))
+    {
+        slot = (slot + 1) & mask;
+    }
+
+    return (int)slot;
+}
+
+/**
+ * @brief Counts values into a dense table indexed by `value - min`.
+ *
+ * @param hist   Pointer to the histogram; `min` and `capacity` must be set.
+ * @param values Pointer to the values.
+ * @param n      Number of values.
+ * @return ERROR_SUCCESS on success, or an appropriate error code on failure.
+ */
+static int
+histogram_fill_dense (Histogram *hist, const int *values, int n)
+{
+    hist->counts = calloc(hist->capacity, sizeof(int));
+
+    if (NULL == hist->counts)
+    {
+        ERROR_LOG("Failed calloc: unable to allocate memory");
+        return ERROR_OUT_OF_MEMORY;
+    }
+
+    for (int idx = 0; idx < n; idx++)
+    {
+        hist->counts[values[idx] - hist->min]++;
+    }
+
+    return ERROR_SUCCESS;
+}
+
+/**
+ * @brief Counts values into an open-addressing hash table.
+ *
+ * @param hist   Pointer to the histogram.
+ * @param values Pointer to the values.
+ * @param n      Number of values.
+ * @return ERROR_SUCCESS on success, or an appropriate error code on failure.
+ */
+static int
+histogram_fill_hash (Histogram *hist, const int *values, int n)
+{
+    long long capacity = 16;
+
+    hist->shift = 28;
+
+    // Sized in 64 bits, as twice a large count does not fit in an int
+    while (capacity < 2LL * n)
+    {
+        capacity *= 2;
+        hist->shift--;
+    }
+
+    if (INT_MAX < capacity)
+    {
+        ERROR_LOG("Invalid input to array_histogram: too many values");
+        return ERROR_OUT_OF_RANGE;
+    }
+
+    hist->capacity = (int)capacity;
+
+    hist->counts = calloc(hist->capacity, sizeof(int));
+    hist->keys   = malloc(hist->capacity * sizeof(int));
+
+    if ((NULL == hist->counts) || (NULL == hist->keys))
+    {
+        ERROR_LOG("Failed to allocate memory for histogram");
+        return ERROR_OUT_OF_MEMORY;
+    }
+
+    for (int idx = 0; idx < n; idx++)
+    {
+        int slot = histogram_slot(hist, values[idx]);
+
+        hist->keys[slot] = values[idx];
+        hist->counts[slot]++;
+    }
+
+    return ERROR_SUCCESS;
+}
+
+Histogram *
+array_histogram (const Array *array)
+{
+    Histogram *hist = NULL;
+
+    if ((NULL == array) || (TYPE_INT != array->ele_type))
+    {
+        ERROR_LOG("Invalid input to array_histogram: expected an int array");
+        goto EXIT;
+    }
+
+    hist = calloc(1, sizeof(Histogram));
+
+    if (NULL == hist)
+    {
+        ERROR_LOG("Failed calloc: unable to allocate memory");
+        goto EXIT;
+    }
+
+    const int *values = (const int *)array->data;
+    int        n      = array->idx;
+    int        status = ERROR_UNKNOWN;
+
+    // An empty array still gets a (dense, single-slot) table to query
+    hist->min = (0 < n) ? kernel_min_int(values, n) : 0;
+
+    long long range
+        = (0 < n) ? (long long)kernel_max_int(values, n) - hist->min + 1 : 1;
+
+    // A range too wide for an int index goes to the hash table instead
+    if ((range <= 2LL * n + HISTOGRAM_DENSE_SLACK) && (INT_MAX >= range))
+    {
+        hist->b_dense  = true;
+        hist->capacity = (int)range;
+        status         = histogram_fill_dense(hist, values, n);
+    }
+    else
+    {
+        hist->b_dense = false;
+        status        = histogram_fill_hash(hist, values, n);
+    }
+
+    if (ERROR_SUCCESS != status)
+    {
+        histogram_destroy(hist);
+        hist = NULL;
+    }
+
+EXIT:
+    return hist;
+}
+
+int
+histogram_count (const Histogram *hist, int value)
+{
+    if (NULL == hist)
+    {
+        return 0;
+    }
+
+    if (true == hist->b_dense)
+    {
+        long long slot = (long long)value - hist->min;
+
+        return ((0 <= slot) && (hist->capacity > slot)) ? hist->counts[slot]
+                                                         : 0;
+    }
+
+    return hist->counts[histogram_slot(hist, value)];
+}
+
+void
+histogram_destroy (Histogram *hist)
+{
+    if (NULL != hist)
+    {
+        free(hist->counts);
+        free(hist->keys);
+        hist->counts = NULL;
+        hist->keys   = NULL;
+
+        free(hist);
+        hist = NULL;
+    }
+}
+
+/*** end of file ***/
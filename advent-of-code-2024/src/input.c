@@ -0,0 +1,424 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include "aux.h"
+#include "error.h"
+#include "input.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/**
+ * @file input.c
+ * @brief Input file functions.
+ *
+ * This file contains functions handle all input file functions. A regular
+ * file is mapped only when its size is not a multiple of the page size: the
+ * tail of the last page is then zero-filled by the kernel, which provides
+ * the terminating NUL for free. Files that end exactly on a page boundary,
+ * and streams that cannot be mapped, are read into a heap buffer one byte
+ * larger than the data.
+ *
+ * A streaming input needs no terminator, so every non-empty regular file
+ * is mapped; other streams keep their descriptor open and refill a window
+ * of `INPUT_STREAM_CHUNK` bytes whenever no whole line is left in it.
+ *
+ * Standard input is opened through a duplicate of its descriptor, so it is
+ * mapped when redirected from a regular file, read in chunks when it is a
+ * pipe, and closing the input never closes standard input itself. Input
+ * starts at the current offset of the descriptor, so bytes of standard
+ * input already consumed by the caller are not seen again.
+ */
+
+/**
+ * @brief Initial capacity of the buffer used to load unmappable streams.
+ */
+#define INPUT_READ_CHUNK (64 * 1024)
+
+/* Function Prototypes */
+static int    input_map(Input *input, int fd, off_t offset, size_t size);
+static int    input_read(Input *input, int fd, size_t size_hint);
+static Input *input_start(const char *filename, bool b_stream);
+static int    input_fill(Input *input);
+
+/**
+ * @brief Maps the rest of a regular file read-only into memory.
+ *
+ * The mapping starts at the page holding `offset`, as `mmap` requires, and
+ * the data starts at `offset` within it.
+ *
+ * @param input  Pointer to the input receiving the mapping.
+ * @param fd     Open descriptor of the file.
+ * @param offset Offset of the first byte of input in the file.
+ * @param size   Number of bytes from `offset` to the end of the file.
+ * @return ERROR_SUCCESS on success, or an appropriate error code on failure.
+ */
+static int
+input_map (Input *input, int fd, off_t offset, size_t size)
+{
+    off_t  start = offset - offset % (off_t)sysconf(_SC_PAGESIZE);
+    size_t skip  = (size_t)(offset - start);
+    void  *map   = mmap(NULL, skip + size, PROT_READ, MAP_PRIVATE, fd, start);
+
+    if (MAP_FAILED == map)
+    {
+        return ERROR_FILE_READ;
+    }
+
+    // Purely advisory: let the kernel read ahead aggressively
+    (void)posix_madvise(map, skip + size, POSIX_MADV_SEQUENTIAL);
+
+    input->map      = map;
+    input->map_size = skip + size;
+    input->data     = (char *)map + skip;
+    input->size     = size;
+    return ERROR_SUCCESS;
+}
+
+/**
+ * @brief Reads a file or stream to its end into a heap buffer.
+ *
+ * @param input     Pointer to the input receiving the contents.
+ * @param fd        Open descriptor to read from.
+ * @param size_hint Expected size in bytes, or 0 if unknown.
+ * @return ERROR_SUCCESS on success, or an appropriate error code on failure.
+ */
+static int
+input_read (Input *input, int fd, size_t size_hint)
+{
+    int    return_status = ERROR_SUCCESS;
+    size_t capacity      = (0 < size_hint) ? size_hint + 2 : INPUT_READ_CHUNK;
+    size_t size          = 0;
+    char  *buffer        = malloc(capacity);
+
+    if (NULL == buffer)
+    {
+        ERROR_LOG("Failed malloc: unable to allocate memory");
+        return_status = ERROR_OUT_OF_MEMORY;
+        goto EXIT;
+    }
+
+    for (;;)
+    {
+        // Keep one spare byte for the terminating NUL; a hinted buffer has
+        // one more so the read that reports the end does not grow it
+        if (capacity - 1 == size)
+        {
+            char *grown = realloc(buffer, capacity * 2);
+
+            if (NULL == grown)
+            {
+                ERROR_LOG("Failed realloc: unable to allocate memory");
+                return_status = ERROR_OUT_OF_MEMORY;
+                goto EXIT;
+            }
+
+            buffer = grown;
+            capacity *= 2;
+        }
+
+        ssize_t count = read(fd, buffer + size, capacity - 1 - size);
+
+        if ((0 > count) && (EINTR == errno))
+        {
+            continue;
+        }
+
+        if (0 > count)
+        {
+            ERROR_LOG("Failed read: unable to read input");
+            return_status = ERROR_FILE_READ;
+            goto EXIT;
+        }
+
+        if (0 == count)
+        {
+            break;
+        }
+
+        size += (size_t)count;
+    }
+
+    buffer[size]  = '\0';
+    input->buffer = buffer;
+    input->data   = buffer;
+    input->size   = size;
+    buffer        = NULL;
+
+EXIT:
+    free(buffer);
+    return return_status;
+}
+
+/**
+ * @brief Opens an input file whole or as a stream.
+ *
+ * @param filename Path of the file to open, or `INPUT_STDIN`.
+ * @param b_stream Whether the input is only read line by line.
+ * @return Pointer to the opened input, or NULL on failure.
+ */
+static Input *
+input_start (const char *filename, bool b_stream)
+{
+    Input *input = NULL;
+    int    fd    = -1;
+
+    if (NULL == filename)
+    {
+        ERROR_LOG("Invalid input to input_open: input is NULL");
+        goto EXIT;
+    }
+
+    if (0 == strcmp(filename, INPUT_STDIN))
+    {
+        fd = dup(STDIN_FILENO);
+
+        if (0 > fd)
+        {
+            ERROR_LOG("Failed dup: standard input is not open");
+            goto EXIT;
+        }
+    }
+    else
+    {
+        fd = open(filename, O_RDONLY);
+
+        if (0 > fd)
+        {
+            ERROR_LOG("Failed open: file not found");
+            goto EXIT;
+        }
+    }
+
+    input = calloc(1, sizeof(Input));
+
+    if (NULL == input)
+    {
+        ERROR_LOG("Failed calloc: unable to allocate memory");
+        goto EXIT;
+    }
+
+    input->fd     = -1;
+    input->status = ERROR_SUCCESS;
+
+    struct stat info;
+    off_t       offset    = 0;
+    size_t      size      = 0;
+    bool        b_regular = false;
+
+    // A duplicated standard input may already be partly consumed, so the
+    // input is whatever lies past the current offset
+    if ((0 == fstat(fd, &info)) && (S_ISREG(info.st_mode))
+        && (0 <= (offset = lseek(fd, 0, SEEK_CUR))))
+    {
+        size      = (offset < info.st_size) ? (size_t)(info.st_size - offset)
+                                            : 0;
+        b_regular = true;
+    }
+
+    // The mapping ends with the file, so the file size decides whether the
+    // last page has room for a terminator; a stream needs none
+    long page = sysconf(_SC_PAGESIZE);
+
+    if ((true == b_regular) && (0 < size) && (0 < page)
+        && ((true == b_stream) || (0 != info.st_size % page))
+        && (ERROR_SUCCESS == input_map(input, fd, offset, size)))
+    {
+        goto EXIT;
+    }
+
+    if (true == b_stream)
+    {
+        input->buffer = malloc(INPUT_STREAM_CHUNK);
+
+        if (NULL == input->buffer)
+        {
+            ERROR_LOG("Failed malloc: unable to allocate memory");
+            free(input);
+            input = NULL;
+            goto EXIT;
+        }
+
+        // The descriptor now belongs to the input
+        input->capacity = INPUT_STREAM_CHUNK;
+        input->data     = input->buffer;
+        input->fd       = fd;
+        fd              = -1;
+        goto EXIT;
+    }
+
+    if (ERROR_SUCCESS != input_read(input, fd, size))
+    {
+        free(input);
+        input = NULL;
+    }
+
+EXIT:
+    if (0 <= fd)
+    {
+        close(fd);
+    }
+
+    return input;
+}
+
+/**
+ * @brief Reads the next chunk of a stream into its window.
+ *
+ * The unread tail of the window is first moved to the front, and the window
+ * is doubled only when that tail already fills it, i.e. when a single line
+ * is longer than the window. The descriptor is closed at the end of the
+ * stream or on error.
+ *
+ * @param input Pointer to the streaming input.
+ * @return ERROR_SUCCESS on success, or an appropriate error code on failure.
+ */
+static int
+input_fill (Input *input)
+{
+    size_t  left  = input->size - input->pos;
+    ssize_t count = 0;
+
+    if (0 < input->pos)
+    {
+        memmove(input->buffer, input->buffer + input->pos, left);
+        input->size = left;
+        input->pos  = 0;
+    }
+
+    if (input->capacity == input->size)
+    {
+        char *grown = realloc(input->buffer, input->capacity * 2);
+
+        if (NULL == grown)
+        {
+            ERROR_LOG("Failed realloc: unable to allocate memory");
+            input->status = ERROR_OUT_OF_MEMORY;
+            goto EXIT;
+        }
+
+        input->buffer = grown;
+        input->capacity *= 2;
+    }
+
+    do
+    {
+        count = read(input->fd,
+                     input->buffer + input->size,
+                     input->capacity - input->size);
+    } while ((0 > count) && (EINTR == errno));
+
+    if (0 > count)
+    {
+        ERROR_LOG("Failed read: unable to read input");
+        input->status = ERROR_FILE_READ;
+    }
+    else
+    {
+        input->size += (size_t)count;
+    }
+
+EXIT:
+    input->data = input->buffer;
+
+    if ((ERROR_SUCCESS != input->status) || (0 >= count))
+    {
+        close(input->fd);
+        input->fd = -1;
+    }
+
+    return input->status;
+}
+
+Input *
+input_open (const char *filename)
+{
+    return input_start(filename, false);
+}
+
+Input *
+input_open_stream (const char *filename)
+{
+    return input_start(filename, true);
+}
+
+void
+input_close (Input *input)
+{
+    if (NULL != input)
+    {
+        if (NULL != input->map)
+        {
+            munmap(input->map, input->map_size);
+        }
+
+        if (0 <= input->fd)
+        {
+            close(input->fd);
+        }
+
+        free(input->buffer);
+        input->map    = NULL;
+        input->buffer = NULL;
+        input->data   = NULL;
+        input->fd     = -1;
+
+        free(input);
+        input = NULL;
+    }
+}
+
+bool
+input_next_line (Input *input, Span *line)
+{
+    if ((NULL == input) || (NULL == line))
+    {
+        return false;
+    }
+
+    const char *start = NULL;
+    const char *end   = NULL;
+    size_t      left  = 0;
+
+    // Refill until a whole line is buffered or the stream is exhausted
+    for (;;)
+    {
+        start = input->data + input->pos;
+        left  = input->size - input->pos;
+        end   = (0 < left) ? memchr(start, '\n', left) : NULL;
+
+        if ((NULL != end) || (0 > input->fd))
+        {
+            break;
+        }
+
+        if (ERROR_SUCCESS != input_fill(input))
+        {
+            return false;
+        }
+    }
+
+    if (0 == left)
+    {
+        return false;
+    }
+
+    size_t len = (NULL != end) ? (size_t)(end - start) : left;
+
+    input->pos += (NULL != end) ? len + 1 : len;
+
+    if ((0 < len) && ('\r' == start[len - 1]))
+    {
+        len--;
+    }
+
+    line->data = start;
+    line->len  = len;
+    return true;
+}
+
+/*** end of file ***/
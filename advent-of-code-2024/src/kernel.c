@@ -0,0 +1,482 @@
+#include "kernel.h"
+
+#include <limits.h>
+#include <stddef.h>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define KERNEL_AVX2
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#define KERNEL_SSE2
+#endif
+
+/**
+ * @file kernel.c
+ * @brief Reduction kernel functions.
+ *
+ * This file contains functions handle all reduction kernels. Each kernel
+ * runs a vector loop over as many whole registers as the buffer holds and
+ * finishes the remaining elements with a scalar loop, which is also the
+ * whole implementation when no vector extension is available. Products and
+ * sums are widened to 64 bits inside the vector registers.
+ */
+
+#if defined(KERNEL_AVX2)
+
+/**
+ * @brief Adds eight 32-bit lanes, sign-extended, into four 64-bit lanes.
+ *
+ * @param acc Accumulator of four 64-bit lanes.
+ * @param v   Eight 32-bit lanes to add.
+ * @return The updated accumulator.
+ */
+static inline __m256i
+kernel_add_widened (__m256i acc, __m256i v)
+{
+    __m128i low  = _mm256_castsi256_si128(v);
+    __m128i high = _mm256_extracti128_si256(v, 1);
+
+    acc = _mm256_add_epi64(acc, _mm256_cvtepi32_epi64(low));
+    acc = _mm256_add_epi64(acc, _mm256_cvtepi32_epi64(high));
+    return acc;
+}
+
+/**
+ * @brief Adds the full 64-bit products of eight lane pairs into four lanes.
+ *
+ * @param acc Accumulator of four 64-bit lanes.
+ * @param a   Eight 32-bit multiplicands.
+ * @param b   Eight 32-bit multipliers.
+ * @return The updated accumulator.
+ */
+static inline __m256i
+kernel_add_products (__m256i acc, __m256i a, __m256i b)
+{
+    __m256i even = _mm256_mul_epi32(a, b);
+    __m256i odd  = _mm256_mul_epi32(_mm256_srli_epi64(a, 32),
+                                    _mm256_srli_epi64(b, 32));
+
+    return _mm256_add_epi64(acc, _mm256_add_epi64(even, odd));
+}
+
+/**
+ * @brief Sums the four 64-bit lanes of an accumulator.
+ *
+ * @param acc Accumulator to reduce.
+ * @return The sum of its lanes.
+ */
+static inline long long
+kernel_hsum (__m256i acc)
+{
+    long long lanes[4];
+
+    _mm256_storeu_si256((__m256i *)lanes, acc);
+    return lanes[0] + lanes[1] + lanes[2] + lanes[3];
+}
+
+#elif defined(KERNEL_SSE2)
+
+/**
+ * @brief Adds four 32-bit lanes, sign-extended, into two 64-bit lanes.
+ *
+ * @param acc Accumulator of two 64-bit lanes.
+ * @param v   Four 32-bit lanes to add.
+ * @return The updated accumulator.
+ */
+static inline __m128i
+kernel_add_widened (__m128i acc, __m128i v)
+{
+    __m128i sign = _mm_srai_epi32(v, 31);
+
+    acc = _mm_add_epi64(acc, _mm_unpacklo_epi32(v, sign));
+    acc = _mm_add_epi64(acc, _mm_unpackhi_epi32(v, sign));
+    return acc;
+}
+
+/**
+ * @brief Multiplies the even 32-bit lanes into signed 64-bit products.
+ *
+ * SSE2 only has an unsigned 32x32 to 64-bit multiply; the signed product
+ * is recovered by subtracting `b` (resp. `a`) shifted up 32 bits for each
+ * negative `a` (resp. `b`).
+ *
+ * @param a Multiplicands in lanes 0 and 2.
+ * @param b Multipliers in lanes 0 and 2.
+ * @return Two signed 64-bit products.
+ */
+static inline __m128i
+kernel_mul_even (__m128i a, __m128i b)
+{
+    __m128i product    = _mm_mul_epu32(a, b);
+    __m128i correction = _mm_add_epi32(_mm_and_si128(_mm_srai_epi32(a, 31), b),
+                                       _mm_and_si128(_mm_srai_epi32(b, 31), a));
+
+    return _mm_sub_epi64(product, _mm_slli_epi64(correction, 32));
+}
+
+/**
+ * @brief Adds the full 64-bit products of four lane pairs into two lanes.
+ *
+ * @param acc Accumulator of two 64-bit lanes.
+ * @param a   Four 32-bit multiplicands.
+ * @param b   Four 32-bit multipliers.
+ * @return The updated accumulator.
+ */
+static inline __m128i
+kernel_add_products (__m128i acc, __m128i a, __m128i b)
+{
+    __m128i even = kernel_mul_even(a, b);
+    __m128i odd
+        = kernel_mul_even(_mm_srli_epi64(a, 32), _mm_srli_epi64(b, 32));
+
+    return _mm_add_epi64(acc, _mm_add_epi64(even, odd));
+}
+
+/**
+ * @brief Selects the smaller of each pair of signed 32-bit lanes.
+ *
+ * @param a First set of lanes.
+ * @param b Second set of lanes.
+ * @return The lane-wise minimum.
+ */
+static inline __m128i
+kernel_min (__m128i a, __m128i b)
+{
+    __m128i gt = _mm_cmpgt_epi32(a, b);
+
+    return _mm_or_si128(_mm_and_si128(gt, b), _mm_andnot_si128(gt, a));
+}
+
+/**
+ * @brief Selects the larger of each pair of signed 32-bit lanes.
+ *
+ * @param a First set of lanes.
+ * @param b Second set of lanes.
+ * @return The lane-wise maximum.
+ */
+static inline __m128i
+kernel_max (__m128i a, __m128i b)
+{
+    __m128i gt = _mm_cmpgt_epi32(a, b);
+
+    return _mm_or_si128(_mm_and_si128(gt, a), _mm_andnot_si128(gt, b));
+}
+
+/**
+ * @brief Sums the two 64-bit lanes of an accumulator.
+ *
+ * @param acc Accumulator to reduce.
+ * @return The sum of its lanes.
+ */
+static inline long long
+kernel_hsum (__m128i acc)
+{
+    long long lanes[2];
+
+    _mm_storeu_si128((__m128i *)lanes, acc);
+    return lanes[0] + lanes[1];
+}
+
+#endif
+
+long long
+kernel_sum_int (const int *a, int n)
+{
+    long long total = 0;
+    int       idx   = 0;
+
+    if ((NULL == a) || (0 >= n))
+    {
+        return 0;
+    }
+
+#if defined(KERNEL_AVX2)
+    __m256i acc = _mm256_setzero_si256();
+
+    for (; idx + 8 <= n; idx += 8)
+    {
+        acc = kernel_add_widened(
+            acc, _mm256_loadu_si256((const __m256i *)(a + idx)));
+    }
+
+    total = kernel_hsum(acc);
+#elif defined(KERNEL_SSE2)
+    __m128i acc = _mm_setzero_si128();
+
+    for (; idx + 4 <= n; idx += 4)
+    {
+        acc = kernel_add_widened(acc,
+                                 _mm_loadu_si128((const __m128i *)(a + idx)));
+    }
+
+    total = kernel_hsum(acc);
+#endif
+
+    for (; idx < n; idx++)
+    {
+        total += a[idx];
+    }
+
+    return total;
+}
+
+long long
+kernel_dot_int (const int *a, const int *b, int n)
+{
+    long long total = 0;
+    int       idx   = 0;
+
+    if ((NULL == a) || (NULL == b) || (0 >= n))
+    {
+        return 0;
+    }
+
+#if defined(KERNEL_AVX2)
+    __m256i acc = _mm256_setzero_si256();
+
+    for (; idx + 8 <= n; idx += 8)
+    {
+        acc = kernel_add_products(
+            acc,
+            _mm256_loadu_si256((const __m256i *)(a + idx)),
+            _mm256_loadu_si256((const __m256i *)(b + idx)));
+    }
+
+    total = kernel_hsum(acc);
+#elif defined(KERNEL_SSE2)
+    __m128i acc = _mm_setzero_si128();
+
+    for (; idx + 4 <= n; idx += 4)
+    {
+        acc = kernel_add_products(acc,
+                                  _mm_loadu_si128((const __m128i *)(a + idx)),
+                                  _mm_loadu_si128((const __m128i *)(b + idx)));
+    }
+
+    total = kernel_hsum(acc);
+#endif
+
+    for (; idx < n; idx++)
+    {
+        total += (long long)a[idx] * b[idx];
+    }
+
+    return total;
+}
+
+long long
+kernel_dot_masked_int (const int *a, const int *b, const int *mask, int n)
+{
+    long long total = 0;
+    int       idx   = 0;
+
+    if ((NULL == a) || (NULL == b) || (NULL == mask) || (0 >= n))
+    {
+        return 0;
+    }
+
+    // Masked-out multiplicands are zeroed so their products vanish
+#if defined(KERNEL_AVX2)
+    __m256i acc  = _mm256_setzero_si256();
+    __m256i zero = _mm256_setzero_si256();
+
+    for (; idx + 8 <= n; idx += 8)
+    {
+        __m256i off = _mm256_cmpeq_epi32(
+            _mm256_loadu_si256((const __m256i *)(mask + idx)), zero);
+        __m256i lhs = _mm256_andnot_si256(
+            off, _mm256_loadu_si256((const __m256i *)(a + idx)));
+
+        acc = kernel_add_products(
+            acc, lhs, _mm256_loadu_si256((const __m256i *)(b + idx)));
+    }
+
+    total = kernel_hsum(acc);
+#elif defined(KERNEL_SSE2)
+    __m128i acc  = _mm_setzero_si128();
+    __m128i zero = _mm_setzero_si128();
+
+    for (; idx + 4 <= n; idx += 4)
+    {
+        __m128i off = _mm_cmpeq_epi32(
+            _mm_loadu_si128((const __m128i *)(mask + idx)), zero);
+        __m128i lhs = _mm_andnot_si128(
+            off, _mm_loadu_si128((const __m128i *)(a + idx)));
+
+        acc = kernel_add_products(
+            acc, lhs, _mm_loadu_si128((const __m128i *)(b + idx)));
+    }
+
+    total = kernel_hsum(acc);
+#endif
+
+    for (; idx < n; idx++)
+    {
+        if (0 != mask[idx])
+        {
+            total += (long long)a[idx] * b[idx];
+        }
+    }
+
+    return total;
+}
+
+long long
+kernel_sad_int (const int *a, const int *b, int n)
+{
+    long long total = 0;
+    int       idx   = 0;
+
+    if ((NULL == a) || (NULL == b) || (0 >= n))
+    {
+        return 0;
+    }
+
+    // max - min always fits in an unsigned 32-bit lane, so widen with zeros
+#if defined(KERNEL_AVX2)
+    __m256i acc = _mm256_setzero_si256();
+
+    for (; idx + 8 <= n; idx += 8)
+    {
+        __m256i va   = _mm256_loadu_si256((const __m256i *)(a + idx));
+        __m256i vb   = _mm256_loadu_si256((const __m256i *)(b + idx));
+        __m256i diff = _mm256_sub_epi32(_mm256_max_epi32(va, vb),
+                                        _mm256_min_epi32(va, vb));
+
+        acc = _mm256_add_epi64(
+            acc, _mm256_cvtepu32_epi64(_mm256_castsi256_si128(diff)));
+        acc = _mm256_add_epi64(
+            acc, _mm256_cvtepu32_epi64(_mm256_extracti128_si256(diff, 1)));
+    }
+
+    total = kernel_hsum(acc);
+#elif defined(KERNEL_SSE2)
+    __m128i acc  = _mm_setzero_si128();
+    __m128i zero = _mm_setzero_si128();
+
+    for (; idx + 4 <= n; idx += 4)
+    {
+        __m128i va   = _mm_loadu_si128((const __m128i *)(a + idx));
+        __m128i vb   = _mm_loadu_si128((const __m128i *)(b + idx));
+        __m128i diff = _mm_sub_epi32(kernel_max(va, vb), kernel_min(va, vb));
+
+        acc = _mm_add_epi64(acc, _mm_unpacklo_epi32(diff, zero));
+        acc = _mm_add_epi64(acc, _mm_unpackhi_epi32(diff, zero));
+    }
+
+    total = kernel_hsum(acc);
+#endif
+
+    for (; idx < n; idx++)
+    {
+        total += (a[idx] > b[idx]) ? (long long)a[idx] - b[idx]
+                                   : (long long)b[idx] - a[idx];
+    }
+
+    return total;
+}
+
+int
+kernel_min_int (const int *a, int n)
+{
+    int result = INT_MAX;
+    int idx    = 0;
+
+    if ((NULL == a) || (0 >= n))
+    {
+        return result;
+    }
+
+#if defined(KERNEL_AVX2) || defined(KERNEL_SSE2)
+    if (4 <= n)
+    {
+        int lanes[4];
+#if defined(KERNEL_AVX2)
+        __m256i best = _mm256_set1_epi32(INT_MAX);
+
+        for (; idx + 8 <= n; idx += 8)
+        {
+            best = _mm256_min_epi32(
+                best, _mm256_loadu_si256((const __m256i *)(a + idx)));
+        }
+
+        __m128i low = _mm_min_epi32(_mm256_castsi256_si128(best),
+                                    _mm256_extracti128_si256(best, 1));
+#else
+        __m128i low = _mm_set1_epi32(INT_MAX);
+
+        for (; idx + 4 <= n; idx += 4)
+        {
+            low = kernel_min(low, _mm_loadu_si128((const __m128i *)(a + idx)));
+        }
+#endif
+        _mm_storeu_si128((__m128i *)lanes, low);
+
+        for (int lane = 0; lane < 4; lane++)
+        {
+            result = (lanes[lane] < result) ? lanes[lane] : result;
+        }
+    }
+#endif
+
+    for (; idx < n; idx++)
+    {
+        result = (a[idx] < result) ? a[idx] : result;
+    }
+
+    return result;
+}
+
+int
+kernel_max_int (const int *a, int n)
+{
+    int result = INT_MIN;
+    int idx    = 0;
+
+    if ((NULL == a) || (0 >= n))
+    {
+        return result;
+    }
+
+#if defined(KERNEL_AVX2) || defined(KERNEL_SSE2)
+    if (4 <= n)
+    {
+        int lanes[4];
+#if defined(KERNEL_AVX2)
+        __m256i best = _mm256_set1_epi32(INT_MIN);
+
+        for (; idx + 8 <= n; idx += 8)
+        {
+            best = _mm256_max_epi32(
+                best, _mm256_loadu_si256((const __m256i *)(a + idx)));
+        }
+
+        __m128i low = _mm_max_epi32(_mm256_castsi256_si128(best),
+                                    _mm256_extracti128_si256(best, 1));
+#else
+        __m128i low = _mm_set1_epi32(INT_MIN);
+
+        for (; idx + 4 <= n; idx += 4)
+        {
+            low = kernel_max(low, _mm_loadu_si128((const __m128i *)(a + idx)));
+        }
+#endif
+        _mm_storeu_si128((__m128i *)lanes, low);
+
+        for (int lane = 0; lane < 4; lane++)
+        {
+            result = (lanes[lane] > result) ? lanes[lane] : result;
+        }
+    }
+#endif
+
+    for (; idx < n; idx++)
+    {
+        result = (a[idx] > result) ? a[idx] : result;
+    }
+
+    return result;
+}
+
+/*** end of file ***/
@@ -5,6 +5,7 @@
 #include "day_4.h"
 #include "day_5.h"
 #include "error.h"
+#include "input.h"
 
 #include <stdbool.h>
 #include <stdio.h>
@@ -16,11 +17,17 @@
  * @brief Entry point for running Advent of Code challenges.
  *
  * Supports running all challenges or a specific day's challenge using
- * command-line arguments.
+ * command-line arguments. A single day can also be run on any input file,
+ * or on standard input given as "-", so an input piped from another program
+ * never has to be written to disk first.
  */
 
-#define USAGE_GUIDE "Usage: ./adventofcode [<day_1|day_2|...>]"
-#define ARGS_COUNT  2
+#define USAGE_GUIDE                                  \
+    "Usage: ./adventofcode [<day_1|day_2|...> "      \
+    "[<PATH|->|--input <PATH|->]]"
+#define ARGS_COUNT     2
+#define ARGS_COUNT_MAX 4
+#define INPUT_OPTION   "--input"
 
 /**
  * @brief Structure to map day names to their respective functions.
@@ -110,6 +117,42 @@ run_day (DayChallenge challenge)
     return return_status;
 }
 
+/**
+ * @brief Runs a specific day's challenge on a single input.
+ *
+ * Unlike `run_day`, the input is not looked up in the `data/` directory and
+ * its existence is not checked beforehand, since standard input and pipes
+ * can be opened only once.
+ *
+ * @param challenge A `DayChallenge` structure containing the day name,
+ * function, and day number.
+ * @param file_path Path of the input file, or `INPUT_STDIN` for standard
+ * input.
+ *
+ * @return ERROR_SUCCESS on success, or an appropriate error code on failure.
+ */
+int
+run_input (DayChallenge challenge, const char *file_path)
+{
+    int return_status;
+    int result_array[2] = { 0, 0 };
+
+    printf("\nRunning %s challenge...\n", challenge.day_name);
+    printf("\tReading input: %s. Running...\n",
+           (0 == strcmp(file_path, INPUT_STDIN)) ? "<stdin>" : file_path);
+
+    return_status = challenge.day_function(file_path, result_array);
+
+    if (ERROR_SUCCESS == return_status)
+    {
+        printf("\tPart One: %d\n\tPart Two: %d\n\n",
+               result_array[0],
+               result_array[1]);
+    }
+
+    return return_status;
+}
+
 /**
  * @brief Entry point of the program.
  *
@@ -119,6 +162,9 @@ run_day (DayChallenge challenge)
  * - If no arguments are passed, it runs all the challenges.
  * - If a valid day name (e.g., "day_1") is passed, it runs the corresponding
  * day's challenge.
+ * - If a valid day name is followed by a path, or by "--input" and a path, it
+ * runs that day's challenge on the given file only; a path of "-" reads from
+ * standard input.
  *
  * @param argc Argument count, representing the number of command-line
  * arguments.
@@ -157,7 +203,7 @@ main (int argc, char *argv[])
     }
 
     // print usage guide (too many arguments handed)
-    else if (ARGS_COUNT < argc)
+    else if (ARGS_COUNT_MAX < argc)
     {
         ERROR_LOG("Invalid input to main: too many arguments handed");
         printf("%s\n", USAGE_GUIDE);
@@ -168,14 +214,36 @@ main (int argc, char *argv[])
     else
     {
         const char *requested_chal = argv[1];
+        const char *input_path     = NULL;
         bool        found          = false;
 
+        // an input follows the day either bare or after "--input"
+        if ((ARGS_COUNT_MAX == argc) && (0 == strcmp(argv[2], INPUT_OPTION)))
+        {
+            input_path = argv[3];
+        }
+        else if ((ARGS_COUNT + 1 == argc)
+                 && (0 != strcmp(argv[2], INPUT_OPTION)))
+        {
+            input_path = argv[2];
+        }
+        else if (ARGS_COUNT != argc)
+        {
+            ERROR_LOG("Invalid input to main: malformed input argument");
+            printf("%s\n", USAGE_GUIDE);
+            return_status = ERROR_INVALID_INPUT;
+            goto EXIT;
+        }
+
         for (size_t idx = 0; idx < challenge_count; idx++)
         {
             if (0 == strcmp(requested_chal, challenges[idx].day_name))
             {
-                return_status = run_day(challenges[idx]);
-                found         = true;
+                return_status
+                    = (NULL == input_path)
+                          ? run_day(challenges[idx])
+                          : run_input(challenges[idx], input_path);
+                found = true;
                 break;
             }
         }
@@ -188,6 +256,7 @@ main (int argc, char *argv[])
         }
     }
 
+EXIT:
     return return_status;
 }
 
@@ -0,0 +1,215 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include "aux.h"
+#include "error.h"
+#include "parallel.h"
+
+#include <pthread.h>
+#include <stdbool.h>
+#include <unistd.h>
+
+/**
+ * @file parallel.c
+ * @brief Parallel map/reduce functions.
+ *
+ * This file contains functions handle all parallel array functions. Each
+ * call splits the array into one contiguous chunk per thread, starts a
+ * thread for every chunk but the first, processes the first chunk on the
+ * calling thread and then joins the rest. If a thread cannot be started its
+ * chunk is processed on the calling thread instead.
+ */
+
+/**
+ * @brief Work description for a single chunk.
+ */
+typedef struct
+{
+    const Array  *array;   /**< Array being processed. */
+    ArrayChunkFn  for_fn;  /**< Chunk callback, or NULL when reducing. */
+    ArrayReduceFn reduce;  /**< Reduce callback, or NULL when mapping. */
+    void         *ctx;     /**< Caller-supplied context. */
+    int           start;   /**< First element of the chunk. */
+    int           end;     /**< One past the last element of the chunk. */
+    long long     partial; /**< Partial result of a reduce. */
+} ParallelTask;
+
+/**
+ * @brief Thread count set with `parallel_set_thread_count`, or 0 if unset.
+ */
+static int parallel_threads = 0;
+
+/* Function Prototypes */
+static void *parallel_worker(void *arg);
+static int   parallel_run(ParallelTask *whole, long long *partials);
+
+/**
+ * @brief Thread entry point that processes one chunk.
+ *
+ * @param arg Pointer to the chunk's ParallelTask.
+ * @return Always NULL.
+ */
+static void *
+parallel_worker (void *arg)
+{
+    ParallelTask *task = arg;
+
+    if (NULL != task->reduce)
+    {
+        task->partial
+            = task->reduce(task->array, task->start, task->end, task->ctx);
+    }
+    else
+    {
+        task->for_fn(task->array, task->start, task->end, task->ctx);
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief Splits an array into chunks and processes them in parallel.
+ *
+ * @param whole    Task describing the whole array; its range is ignored.
+ * @param partials Output for the partial result of each chunk, sized for
+ *                 `PARALLEL_MAX_THREADS`, or NULL when mapping.
+ * @return The number of chunks processed.
+ */
+static int
+parallel_run (ParallelTask *whole, long long *partials)
+{
+    ParallelTask tasks[PARALLEL_MAX_THREADS];
+    pthread_t    threads[PARALLEL_MAX_THREADS];
+    bool         b_started[PARALLEL_MAX_THREADS] = { false };
+    int          count      = whole->array->idx;
+    int          num_chunks = parallel_thread_count();
+
+    if (num_chunks > count / PARALLEL_MIN_CHUNK)
+    {
+        num_chunks = count / PARALLEL_MIN_CHUNK;
+    }
+
+    if (1 > num_chunks)
+    {
+        num_chunks = 1;
+    }
+
+    for (int idx = 0; idx < num_chunks; idx++)
+    {
+        tasks[idx]       = *whole;
+        tasks[idx].start = (int)((long long)count * idx / num_chunks);
+        tasks[idx].end   = (int)((long long)count * (idx + 1) / num_chunks);
+    }
+
+    for (int idx = 1; idx < num_chunks; idx++)
+    {
+        b_started[idx] = (0
+                          == pthread_create(&threads[idx],
+                                            NULL,
+                                            parallel_worker,
+                                            &tasks[idx]));
+    }
+
+    // The calling thread takes the first chunk and any that failed to start
+    for (int idx = 0; idx < num_chunks; idx++)
+    {
+        if (false == b_started[idx])
+        {
+            parallel_worker(&tasks[idx]);
+        }
+    }
+
+    for (int idx = 1; idx < num_chunks; idx++)
+    {
+        if (true == b_started[idx])
+        {
+            pthread_join(threads[idx], NULL);
+        }
+    }
+
+    if (NULL != partials)
+    {
+        for (int idx = 0; idx < num_chunks; idx++)
+        {
+            partials[idx] = tasks[idx].partial;
+        }
+    }
+
+    return num_chunks;
+}
+
+int
+parallel_thread_count (void)
+{
+    long count = (0 < parallel_threads) ? parallel_threads
+                                        : sysconf(_SC_NPROCESSORS_ONLN);
+
+    if (1 > count)
+    {
+        return 1;
+    }
+
+    return (PARALLEL_MAX_THREADS < count) ? PARALLEL_MAX_THREADS : (int)count;
+}
+
+void
+parallel_set_thread_count (int count)
+{
+    parallel_threads = (0 < count) ? count : 0;
+}
+
+int
+array_parallel_for (const Array *array, ArrayChunkFn fn, void *ctx)
+{
+    if ((NULL == array) || (NULL == fn))
+    {
+        ERROR_LOG(
+            "Invalid input to array_parallel_for: one or more inputs are NULL");
+        return ERROR_NULL_POINTER;
+    }
+
+    if (0 < array->idx)
+    {
+        ParallelTask whole = { array, fn, NULL, ctx, 0, 0, 0 };
+        parallel_run(&whole, NULL);
+    }
+
+    return ERROR_SUCCESS;
+}
+
+int
+array_parallel_reduce (const Array   *array,
+                       ArrayReduceFn  fn,
+                       ArrayCombineFn combine,
+                       void          *ctx,
+                       long long     *result)
+{
+    long long partials[PARALLEL_MAX_THREADS];
+
+    if ((NULL == array) || (NULL == fn) || (NULL == result))
+    {
+        ERROR_LOG(
+            "Invalid input to array_parallel_reduce: one or more inputs are "
+            "NULL");
+        return ERROR_NULL_POINTER;
+    }
+
+    *result = 0;
+
+    if (0 < array->idx)
+    {
+        ParallelTask whole      = { array, NULL, fn, ctx, 0, 0, 0 };
+        int          num_chunks = parallel_run(&whole, partials);
+
+        *result = partials[0];
+
+        for (int idx = 1; idx < num_chunks; idx++)
+        {
+            *result = (NULL != combine) ? combine(*result, partials[idx])
+                                        : *result + partials[idx];
+        }
+    }
+
+    return ERROR_SUCCESS;
+}
+
+/*** end of file ***/
@@ -0,0 +1,357 @@
+#include "error.h"
+#include "parse.h"
+
+#include <limits.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#if defined(__SSE4_1__)
+#include <smmintrin.h>
+#define PARSE_SSE41
+#endif
+
+#if defined(__BYTE_ORDER__) && (__ORDER_LITTLE_ENDIAN__ == __BYTE_ORDER__)
+#define PARSE_SWAR
+#endif
+
+/**
+ * @file parse.c
+ * @brief Decimal integer parsing functions.
+ *
+ * This file contains functions handle all integer parsing functions. The
+ * SWAR path loads eight characters into one little-endian word, finds how
+ * many of them are digits with a few masks, and folds up to eight digits
+ * into their value with three multiplications: adjacent digits are first
+ * combined into pairs, then pairs into fours, then fours into eight. The
+ * SSE4.1 path does the same folding across a 16-byte register.
+ */
+
+/**
+ * @brief Powers of ten up to the eight digits of one SWAR group.
+ */
+static const unsigned long long g_pow10[] = {
+    1ULL,      10ULL,      100ULL,      1000ULL,      10000ULL,
+    100000ULL, 1000000ULL, 10000000ULL, 100000000ULL,
+};
+
+/* Function Prototypes */
+static bool        b_is_digit(char ch);
+static void        parse_accumulate(unsigned long long *value,
+                                    unsigned long long  part,
+                                    int                 num_digits,
+                                    unsigned long long  limit,
+                                    bool               *b_overflow);
+static const char *parse_digits(const char         *str,
+                                const char         *end,
+                                unsigned long long  limit,
+                                unsigned long long *value,
+                                bool               *b_overflow);
+
+#if defined(PARSE_SWAR)
+
+/**
+ * @brief Counts the digits at the start of eight loaded characters.
+ *
+ * A byte is a digit when its high nibble is 3 and its low nibble is at most
+ * 9; adding 6 to the low nibble carries into the high nibble exactly when
+ * it exceeds 9, and never into the next byte.
+ *
+ * @param chunk Eight characters, the first in the lowest byte.
+ * @return The number of leading digits, from 0 to 8.
+ */
+static inline int
+swar_digit_count (uint64_t chunk)
+{
+    uint64_t high = (chunk & 0xF0F0F0F0F0F0F0F0ULL) ^ 0x3030303030303030ULL;
+    uint64_t low  = ((chunk & 0x0F0F0F0F0F0F0F0FULL) + 0x0606060606060606ULL)
+                   & 0xF0F0F0F0F0F0F0F0ULL;
+    uint64_t bad  = high | low;
+
+    // Set the top bit of every non-zero byte, without carries between bytes
+    uint64_t flags = (((bad & 0x7F7F7F7F7F7F7F7FULL) + 0x7F7F7F7F7F7F7F7FULL)
+                      | bad)
+                     & 0x8080808080808080ULL;
+
+    return (0 == flags) ? 8 : __builtin_ctzll(flags) / 8;
+}
+
+/**
+ * @brief Converts the leading digits of eight loaded characters.
+ *
+ * The digits are shifted to the top of the word, which both discards the
+ * trailing non-digits and pads the front with zeros, so every count is
+ * handled as eight digits.
+ *
+ * @param chunk      Eight characters, the first in the lowest byte.
+ * @param num_digits Number of leading digits, from 1 to 8.
+ * @return The value of the digits.
+ */
+static inline uint64_t
+swar_digit_value (uint64_t chunk, int num_digits)
+{
+    uint64_t val = (chunk - 0x3030303030303030ULL) << (8 * (8 - num_digits));
+
+    val = (val * 10) + (val >> 8);
+    val = (((val & 0x000000FF000000FFULL) * (100 + (1000000ULL << 32)))
+           + (((val >> 16) & 0x000000FF000000FFULL)
+              * (1 + (10000ULL << 32))))
+          >> 32;
+    return val;
+}
+
+#endif // PARSE_SWAR
+
+/**
+ * @brief Checks whether a character is a decimal digit.
+ *
+ * @param ch Character to check.
+ * @return `true` for '0' to '9', `false` otherwise.
+ */
+static bool
+b_is_digit (char ch)
+{
+    return ('0' <= ch) && ('9' >= ch);
+}
+
+/**
+ * @brief Appends a group of digits to a running value, checking the limit.
+ *
+ * @param value      Running value.
+ * @param part       Value of the new digits.
+ * @param num_digits Number of new digits.
+ * @param limit      Largest value allowed.
+ * @param b_overflow Set once the value passes `limit`; the value then stops
+ *                   changing.
+ */
+static void
+parse_accumulate (unsigned long long *value,
+                  unsigned long long  part,
+                  int                 num_digits,
+                  unsigned long long  limit,
+                  bool               *b_overflow)
+{
+    if ((true == *b_overflow)
+        || ((limit - part) / g_pow10[num_digits] < *value))
+    {
+        *b_overflow = true;
+        return;
+    }
+
+    *value = *value * g_pow10[num_digits] + part;
+}
+
+/**
+ * @brief Consumes a run of digits, eight at a time where possible.
+ *
+ * @param str        Pointer to the first character.
+ * @param end        Pointer one past the last readable character.
+ * @param limit      Largest value allowed.
+ * @param value      Output for the value of the digits.
+ * @param b_overflow Output set if the value passed `limit`.
+ * @return Pointer to the first character that is not a digit.
+ */
+static const char *
+parse_digits (const char         *str,
+              const char         *end,
+              unsigned long long  limit,
+              unsigned long long *value,
+              bool               *b_overflow)
+{
+    *value      = 0;
+    *b_overflow = false;
+
+#if defined(PARSE_SWAR)
+    while (8 <= end - str)
+    {
+        uint64_t chunk;
+
+        memcpy(&chunk, str, sizeof(chunk));
+
+        int num_digits = swar_digit_count(chunk);
+
+        if (0 == num_digits)
+        {
+            return str;
+        }
+
+        parse_accumulate(value,
+                         swar_digit_value(chunk, num_digits),
+                         num_digits,
+                         limit,
+                         b_overflow);
+        str += num_digits;
+
+        if (8 > num_digits)
+        {
+            return str;
+        }
+    }
+#endif // PARSE_SWAR
+
+    while ((str < end) && (b_is_digit(*str)))
+    {
+        parse_accumulate(
+            value, (unsigned long long)(*str - '0'), 1, limit, b_overflow);
+        str++;
+    }
+
+    return str;
+}
+
+int
+parse_long (const char *str, const char *end, long *value, const char **next)
+{
+    if (NULL != next)
+    {
+        *next = str;
+    }
+
+    if ((NULL == str) || (NULL == end) || (NULL == value))
+    {
+        return ERROR_NULL_POINTER;
+    }
+
+    const char *pos        = str;
+    bool        b_negative = false;
+
+    if ((pos < end) && (('-' == *pos) || ('+' == *pos)))
+    {
+        b_negative = ('-' == *pos);
+        pos++;
+    }
+
+    // The magnitude of LONG_MIN is one more than LONG_MAX
+    unsigned long long limit      = (unsigned long long)LONG_MAX
+                               + ((true == b_negative) ? 1 : 0);
+    unsigned long long magnitude  = 0;
+    bool               b_overflow = false;
+    const char        *stop
+        = parse_digits(pos, end, limit, &magnitude, &b_overflow);
+
+    if (pos == stop)
+    {
+        return ERROR_INVALID_INPUT;
+    }
+
+    if (NULL != next)
+    {
+        *next = stop;
+    }
+
+    if (true == b_overflow)
+    {
+        *value = (true == b_negative) ? LONG_MIN : LONG_MAX;
+        return ERROR_OUT_OF_RANGE;
+    }
+
+    if (false == b_negative)
+    {
+        *value = (long)magnitude;
+    }
+    else
+    {
+        // Step past LONG_MAX so the magnitude of LONG_MIN never overflows
+        *value = (0 == magnitude) ? 0 : -(long)(magnitude - 1) - 1;
+    }
+
+    return ERROR_SUCCESS;
+}
+
+int
+parse_int (const char *str, const char *end, int *value, const char **next)
+{
+    if (NULL == value)
+    {
+        return ERROR_NULL_POINTER;
+    }
+
+    long wide   = 0;
+    int  status = parse_long(str, end, &wide, next);
+
+    if ((ERROR_SUCCESS != status) && (ERROR_OUT_OF_RANGE != status))
+    {
+        return status;
+    }
+
+    if ((INT_MIN > wide) || (INT_MAX < wide))
+    {
+        wide   = (0 > wide) ? INT_MIN : INT_MAX;
+        status = ERROR_OUT_OF_RANGE;
+    }
+
+    *value = (int)wide;
+    return status;
+}
+
+int
+parse_fixed (const char *str, const char *end, int width, long long *value)
+{
+    if ((NULL == str) || (NULL == end) || (NULL == value))
+    {
+        return ERROR_NULL_POINTER;
+    }
+
+    if ((1 > width) || (PARSE_FIXED_MAX_WIDTH < width) || (width > end - str)
+        || ((width < end - str) && (b_is_digit(str[width]))))
+    {
+        return ERROR_INVALID_INPUT;
+    }
+
+#if defined(PARSE_SSE41)
+    if (16 <= end - str)
+    {
+        const __m128i zero  = _mm_set1_epi8('0');
+        const __m128i nine  = _mm_set1_epi8(9);
+        __m128i       chars = _mm_loadu_si128((const __m128i *)str);
+        __m128i       vals  = _mm_sub_epi8(chars, zero);
+        int           mask  = _mm_movemask_epi8(
+            _mm_cmpeq_epi8(_mm_max_epu8(vals, nine), nine));
+        int           need  = (1 << width) - 1;
+
+        if (need != (mask & need))
+        {
+            return ERROR_INVALID_INPUT;
+        }
+
+        // Move the digits to the end of the register; indices that end up
+        // negative select zero, which pads the front with leading zeros
+        __m128i index = _mm_add_epi8(
+            _mm_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15),
+            _mm_set1_epi8((char)(width - 16)));
+
+        vals = _mm_shuffle_epi8(vals, index);
+
+        // Fold 16 digits into pairs, fours and finally two runs of eight
+        vals = _mm_maddubs_epi16(
+            vals, _mm_setr_epi8(10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10,
+                                1, 10, 1));
+        vals = _mm_madd_epi16(
+            vals, _mm_setr_epi16(100, 1, 100, 1, 100, 1, 100, 1));
+        vals = _mm_packus_epi32(vals, vals);
+        vals = _mm_madd_epi16(
+            vals, _mm_setr_epi16(10000, 1, 10000, 1, 10000, 1, 10000, 1));
+
+        *value = (long long)_mm_cvtsi128_si32(vals) * 100000000LL
+                 + _mm_extract_epi32(vals, 1);
+        return ERROR_SUCCESS;
+    }
+#endif // PARSE_SSE41
+
+    long long total = 0;
+
+    for (int idx = 0; idx < width; idx++)
+    {
+        if (false == b_is_digit(str[idx]))
+        {
+            return ERROR_INVALID_INPUT;
+        }
+
+        total = total * 10 + (str[idx] - '0');
+    }
+
+    *value = total;
+    return ERROR_SUCCESS;
+}
+
+/*** end of file ***/
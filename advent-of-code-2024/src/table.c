@@ -4,6 +4,7 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 /**
  * @file table.c
@@ -13,8 +14,25 @@
  * the table contains arrays.
  */
 
-Table *
-table_initialization (ElementType ele_type, int num_rows)
+/* Function Prototypes */
+static Table *table_create(ElementType ele_type, int num_rows, Arena *arena);
+static int    table_ensure_rows(Table *table, int num_rows);
+static int    table_prepare_output(const Table *src,
+                                   Table       *dst,
+                                   int          needed,
+                                   int          width);
+static inline void table_append(Array *out, const char *ele);
+
+/**
+ * @brief Allocates a table structure and each of its rows.
+ *
+ * @param ele_type The type of elements stored in the array.
+ * @param num_rows The number of rows within the table.
+ * @param arena    Arena to allocate from, or NULL to use the heap.
+ * @return Pointer to the newly created table, or NULL on failure.
+ */
+static Table *
+table_create (ElementType ele_type, int num_rows, Arena *arena)
 {
     Table *table = NULL;
 
@@ -25,26 +43,48 @@ table_initialization (ElementType ele_type, int num_rows)
         goto EXIT;
     }
 
-    table = calloc(1, sizeof(Table));
-
-    if (NULL == table)
+    if (NULL != arena)
     {
-        ERROR_LOG("Failed calloc: unable to allocate memory");
-        goto EXIT;
+        table = arena_alloc(arena, sizeof(Table));
+
+        if (NULL != table)
+        {
+            table->content = arena_alloc(arena, num_rows * sizeof(Array *));
+        }
     }
+    else
+    {
+        table = calloc(1, sizeof(Table));
 
-    table->num_rows = num_rows;
-    table->content  = calloc(table->num_rows, sizeof(Array *));
+        if (NULL != table)
+        {
+            table->content = calloc(num_rows, sizeof(Array *));
+        }
+    }
 
-    if (NULL == table->content)
+    if ((NULL == table) || (NULL == table->content))
     {
-        ERROR_LOG("Failed calloc: unable to allocate memory");
+        ERROR_LOG("Failed to allocate memory for table");
+
+        if ((NULL == arena) && (NULL != table))
+        {
+            free(table);
+        }
+
+        table = NULL;
         goto EXIT;
     }
 
+    memset(table->content, 0, num_rows * sizeof(Array *));
+    table->num_rows = num_rows;
+    table->head     = 0;
+    table->arena    = arena;
+
     for (int idx = 0; idx < table->num_rows; idx++)
     {
-        table->content[idx] = array_initialization(ele_type);
+        table->content[idx] = (NULL != arena)
+                                  ? array_initialization_arena(ele_type, arena)
+                                  : array_initialization(ele_type);
 
         if (NULL == table->content[idx])
         {
@@ -58,10 +98,168 @@ EXIT:
     return table;
 }
 
+/**
+ * @brief Grows a table to at least the given number of rows.
+ *
+ * Existing rows keep their logical order and the ring head is reset to
+ * zero; new rows are empty and share the table's element type and owner.
+ *
+ * @param table    Pointer to the table.
+ * @param num_rows Minimum number of rows.
+ * @return ERROR_SUCCESS on success, or an appropriate error code on failure.
+ */
+static int
+table_ensure_rows (Table *table, int num_rows)
+{
+    if (table->num_rows >= num_rows)
+    {
+        return ERROR_SUCCESS;
+    }
+
+    Array      **content = NULL;
+    const Array *first   = table->content[0];
+    size_t       size    = (size_t)num_rows * sizeof(Array *);
+
+    content = (NULL != table->arena) ? arena_alloc(table->arena, size)
+                                     : malloc(size);
+
+    if (NULL == content)
+    {
+        ERROR_LOG("Failed to allocate memory for table rows");
+        return ERROR_OUT_OF_MEMORY;
+    }
+
+    for (int row = 0; row < table->num_rows; row++)
+    {
+        content[row] = TABLE_ROW(table, row);
+    }
+
+    for (int row = table->num_rows; row < num_rows; row++)
+    {
+        content[row]
+            = (NULL != table->arena)
+                  ? array_initialization_arena(first->ele_type, table->arena)
+                  : array_initialization(first->ele_type);
+
+        if (NULL == content[row])
+        {
+            // Hand back the rows created so far before giving up
+            for (int idx = table->num_rows; idx < row; idx++)
+            {
+                array_destroy(content[idx]);
+            }
+
+            if (NULL == table->arena)
+            {
+                free(content);
+            }
+
+            return ERROR_OUT_OF_MEMORY;
+        }
+    }
+
+    if (NULL == table->arena)
+    {
+        free(table->content);
+    }
+
+    table->content  = content;
+    table->num_rows = num_rows;
+    table->head     = 0;
+    return ERROR_SUCCESS;
+}
+
+/**
+ * @brief Validates a transform's tables and sizes its output.
+ *
+ * Every row of `dst` is emptied and reserved for `width` elements, so the
+ * transform can append without checking capacity. Since the old contents
+ * are discarded, the ring head is realigned to slot zero, which lets
+ * logical row `r` be reached as `dst->content[r]`.
+ *
+ * @param src    Pointer to the source table.
+ * @param dst    Pointer to the destination table.
+ * @param needed Number of rows the transform produces.
+ * @param width  Number of elements each produced row may hold.
+ * @return ERROR_SUCCESS on success, or an appropriate error code on failure.
+ */
+static int
+table_prepare_output (const Table *src, Table *dst, int needed, int width)
+{
+    if ((src == dst) || (NULL == src->content) || (NULL == dst->content)
+        || (TABLE_ROW(src, 0)->ele_type != TABLE_ROW(dst, 0)->ele_type)
+        || (TABLE_ROW(src, 0)->ele_size != TABLE_ROW(dst, 0)->ele_size))
+    {
+        ERROR_LOG("Invalid input to table transform: incompatible tables");
+        return ERROR_INVALID_INPUT;
+    }
+
+    int return_status = table_ensure_rows(dst, needed);
+
+    for (int row = 0; (ERROR_SUCCESS == return_status) && (row < dst->num_rows);
+         row++)
+    {
+        return_status = array_reset(dst->content[row]);
+
+        if ((ERROR_SUCCESS == return_status) && (row < needed))
+        {
+            return_status = array_reserve(dst->content[row], width);
+        }
+    }
+
+    dst->head = 0;
+    return return_status;
+}
+
+/**
+ * @brief Appends an element to a row whose capacity is already reserved.
+ *
+ * Transforms move single bytes for `TYPE_CHAR` tables, so that case is
+ * copied directly rather than through a variable-sized `memcpy`.
+ *
+ * @param out Pointer to the row.
+ * @param ele Pointer to the element to append.
+ */
+static inline void
+table_append (Array *out, const char *ele)
+{
+    char *slot = (char *)out->data + (size_t)out->idx * out->ele_size;
+
+    if (1 == out->ele_size)
+    {
+        *slot = *ele;
+    }
+    else
+    {
+        memcpy(slot, ele, out->ele_size);
+    }
+
+    out->idx++;
+}
+
+Table *
+table_initialization (ElementType ele_type, int num_rows)
+{
+    return table_create(ele_type, num_rows, NULL);
+}
+
+Table *
+table_initialization_arena (ElementType ele_type, int num_rows, Arena *arena)
+{
+    if (NULL == arena)
+    {
+        ERROR_LOG("Invalid input to table_initialization_arena: arena is NULL");
+        return NULL;
+    }
+
+    return table_create(ele_type, num_rows, arena);
+}
+
 void
 table_destroy (Table *table)
 {
-    if (NULL != table)
+    // Arena-backed tables are released with their arena
+    if ((NULL != table) && (NULL == table->arena))
     {
         for (int idx = 0; idx < table->num_rows; idx++)
         {
@@ -79,6 +277,17 @@ table_destroy (Table *table)
     return;
 }
 
+Array *
+table_get_row (const Table *table, int row)
+{
+    if ((NULL == table) || (0 > row) || (table->num_rows <= row))
+    {
+        return NULL;
+    }
+
+    return TABLE_ROW(table, row);
+}
+
 int
 table_add_element (Table *table, int row, const void *ele)
 {
@@ -98,7 +307,7 @@ table_add_element (Table *table, int row, const void *ele)
     }
     else
     {
-        return_status = array_add(table->content[row], ele);
+        return_status = array_add(TABLE_ROW(table, row), ele);
     }
 
     return return_status;
@@ -121,7 +330,7 @@ table_reset_row (Table *table, int row)
     }
     else
     {
-        return_status = array_reset(table->content[row]);
+        return_status = array_reset(TABLE_ROW(table, row));
     }
 
     return return_status;
@@ -145,13 +354,264 @@ table_copy_row (Table *table, int src, int dst)
     }
     else
     {
+        return_status
+            = array_copy(TABLE_ROW(table, src), TABLE_ROW(table, dst));
+    }
+
+    return return_status;
+}
+
+int
+table_swap_rows (Table *table, int a, int b)
+{
+    if (NULL == table)
+    {
+        ERROR_LOG("Invalid input to table_swap_rows: input is NULL.");
+        return ERROR_NULL_POINTER;
+    }
+
+    if ((0 > a) || (table->num_rows <= a) || (0 > b)
+        || (table->num_rows <= b))
+    {
+        ERROR_LOG("Invalid input to table_swap_rows: row index out of bounds");
+        return ERROR_INDEX_OUT_OF_BOUNDS;
+    }
+
+    Array *temp         = TABLE_ROW(table, a);
+    TABLE_ROW(table, a) = TABLE_ROW(table, b);
+    TABLE_ROW(table, b) = temp;
+    return ERROR_SUCCESS;
+}
+
+int
+table_rotate_rows (Table *table)
+{
+    if ((NULL == table) || (NULL == table->content))
+    {
+        ERROR_LOG("Invalid input to table_rotate_rows: input is NULL.");
+        return ERROR_NULL_POINTER;
+    }
+
+    table->head = (table->head + 1) % table->num_rows;
+    return ERROR_SUCCESS;
+}
+
+int
+table_push_row (Table *table, const void *eles, int count)
+{
+    // Refill the oldest row first, so a failed fill drops nothing
+    int return_status = table_set_row_from_buffer(table, 0, eles, count);
+
+    if (ERROR_SUCCESS != return_status)
+    {
+        ERROR_LOG("Failed table_set_row_from_buffer: unable to fill new row");
+        goto EXIT;
+    }
+
+    return_status = table_rotate_rows(table);
+
+EXIT:
+    return return_status;
+}
+
+int
+table_set_row_from_buffer (Table *table, int row, const void *eles, int count)
+{
+    int return_status = ERROR_UNKNOWN;
+
+    if ((NULL == table) || ((NULL == eles) && (0 < count)))
+    {
+        ERROR_LOG(
+            "Invalid input to table_set_row_from_buffer: one or more inputs "
+            "are NULL.");
+        return_status = ERROR_NULL_POINTER;
+        goto EXIT;
+    }
+
+    if ((0 > row) || (table->num_rows <= row))
+    {
+        ERROR_LOG(
+            "Invalid input to table_set_row_from_buffer: row index out of "
+            "bounds.");
+        return_status = ERROR_INDEX_OUT_OF_BOUNDS;
+        goto EXIT;
+    }
+
+    if (0 > count)
+    {
+        ERROR_LOG("Invalid input to table_set_row_from_buffer: negative count");
+        return_status = ERROR_INVALID_INPUT;
+        goto EXIT;
+    }
+
+    Array *array = TABLE_ROW(table, row);
+
+    if (TYPE_CHAR == array->ele_type)
+    {
+        const char *chars = eles;
+
+        // Drop "\n", then the "\r" of a "\r\n" or bare "\r" ending
+        if ((0 < count) && ('\n' == chars[count - 1]))
+        {
+            count--;
+        }
+
+        if ((0 < count) && ('\r' == chars[count - 1]))
+        {
+            count--;
+        }
+    }
+
+    // Grow before clearing, so a failed fill leaves the row as it was
+    return_status = array_reserve(array, count);
+
+    if (ERROR_SUCCESS == return_status)
+    {
+        return_status = array_reset(array);
+    }
+
+    if (ERROR_SUCCESS == return_status)
+    {
+        return_status = array_add_n(array, eles, count);
+    }
+
+    if (ERROR_SUCCESS != return_status)
+    {
+        ERROR_LOG("Failed array_add_n: unable to fill the row");
+    }
+
+EXIT:
+    return return_status;
+}
+
+int
+table_width (const Table *table)
+{
+    int width = 0;
+
+    if (NULL == table)
+    {
+        return width;
+    }
+
+    for (int row = 0; row < table->num_rows; row++)
+    {
+        int len = TABLE_ROW(table, row)->idx;
+        width   = (len > width) ? len : width;
+    }
+
+    return width;
+}
+
+int
+table_transpose (const Table *src, Table *dst, const void *fill)
+{
+    int return_status = ERROR_NULL_POINTER;
+
+    if ((NULL == src) || (NULL == dst) || (NULL == fill))
+    {
+        ERROR_LOG(
+            "Invalid input to table_transpose: one or more inputs are NULL.");
+        goto EXIT;
+    }
+
+    int width = table_width(src);
+
+    return_status = table_prepare_output(src, dst, width, src->num_rows);
+
+    if (ERROR_SUCCESS != return_status)
+    {
+        ERROR_LOG("Failed table_transpose: unable to size destination");
+        goto EXIT;
+    }
+
+    // Walk the source a row at a time, appending one cell to every column
+    for (int row = 0; row < src->num_rows; row++)
+    {
+        const Array *in    = TABLE_ROW(src, row);
+        const char  *cells = in->data;
+
+        for (int col = 0; col < width; col++)
+        {
+            table_append(dst->content[col],
+                         (col < in->idx)
+                             ? cells + (size_t)col * in->ele_size
+                             : (const char *)fill);
+        }
+    }
+
+EXIT:
+    return return_status;
+}
+
+int
+table_diagonals (const Table *src,
+                 Table       *dst,
+                 bool         b_anti,
+                 const void  *fill)
+{
+    int return_status = ERROR_NULL_POINTER;
+
+    if ((NULL == src) || (NULL == dst) || (NULL == fill))
+    {
+        ERROR_LOG(
+            "Invalid input to table_diagonals: one or more inputs are NULL.");
+        goto EXIT;
+    }
+
+    int width     = table_width(src);
+    int num_diags = (0 < width) ? src->num_rows + width - 1 : 0;
+    int longest   = (src->num_rows < width) ? src->num_rows : width;
 
-        return_status = array_copy(table->content[src], table->content[dst]);
+    return_status = table_prepare_output(src, dst, num_diags, longest);
+
+    if (ERROR_SUCCESS != return_status)
+    {
+        ERROR_LOG("Failed table_diagonals: unable to size destination");
+        goto EXIT;
     }
 
+    // Walk the source a row at a time; each diagonal meets a row at most
+    // once, top to bottom, so appending keeps every diagonal in order. Cell
+    // (row, col) lies on anti-diagonal row + col, or on diagonal
+    // col - row + num_rows - 1
+    for (int row = 0; row < src->num_rows; row++)
+    {
+        const Array *in    = TABLE_ROW(src, row);
+        const char  *cells = in->data;
+        int          diag  = (true == b_anti) ? row : src->num_rows - 1 - row;
+
+        for (int col = 0; col < width; col++)
+        {
+            table_append(dst->content[diag + col],
+                         (col < in->idx)
+                             ? cells + (size_t)col * in->ele_size
+                             : (const char *)fill);
+        }
+    }
+
+EXIT:
     return return_status;
 }
 
+void
+table_diagonal_start (
+    int num_rows, int width, int diagonal, bool b_anti, int *row, int *col)
+{
+    if (true == b_anti)
+    {
+        // Anti-diagonal k holds the cells with row + col == k
+        *row = (diagonal > width - 1) ? diagonal - (width - 1) : 0;
+        *col = diagonal - *row;
+    }
+    else
+    {
+        // Diagonal k holds the cells with col - row == k - (num_rows - 1)
+        *row = (diagonal < num_rows - 1) ? num_rows - 1 - diagonal : 0;
+        *col = *row + diagonal - (num_rows - 1);
+    }
+}
+
 void
 table_print (Table *table)
 {
@@ -172,7 +632,7 @@ table_print (Table *table)
     for (int idx = 0; idx < table->num_rows; idx++)
     {
         printf("\t");
-        array_print(table->content[idx]);
+        array_print(TABLE_ROW(table, idx));
     }
 
     printf("\n");
@@ -1,13 +1,35 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include "array.h"
 #include "aux.h"
+#include "bitmatrix.h"
+#include "cursor.h"
 #include "day_1.h"
 #include "day_2.h"
 #include "day_3.h"
 #include "day_4.h"
 #include "day_5.h"
+#include "error.h"
+#include "graph.h"
+#include "grid.h"
+#include "histogram.h"
+#include "input.h"
+#include "kernel.h"
+#include "parallel.h"
+#include "parse.h"
+#include "table.h"
 
 #include <CUnit/Basic.h>
+#include <errno.h>
+#include <limits.h>
+#include <pthread.h>
+#include <stdbool.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+#include <sys/ioctl.h>
+#include <time.h>
+#include <unistd.h>
 
 /**
  * @file test_main.c
@@ -19,12 +41,107 @@
  * terminates the test run if any setup or execution fails.
  */
 
+/* Number of random strings fed to the integer parser */
+#define PARSE_TEST_CASES 100000
+
+/* Longest random string fed to the integer parser */
+#define PARSE_TEST_LENGTH 32
+
+/* Number of random integers fed to the sorts */
+#define SORT_TEST_CASES 5000
+
+/* Elements held by a heap-backed array in the ownership tests */
+#define MOVE_TEST_HEAP 100
+
+/* Distinct keys counted by the strided histogram test */
+#define HISTOGRAM_TEST_KEYS 30000
+
+/* Longest random sorted array searched by the bound test */
+#define BOUND_TEST_LENGTH 40
+
+/* Nodes of the random acyclic graph in the topological sort test */
+#define GRAPH_TEST_NODES 64
+
+/* Rows and columns of the bit matrix test; the last column is in word 2 */
+#define BITMATRIX_TEST_ROWS 3
+#define BITMATRIX_TEST_COLS 130
+
+/* Rows and columns of the walled grid in the graph search test */
+#define SEARCH_TEST_ROWS 6
+#define SEARCH_TEST_COLS 8
+
+/* Random fields fed to the fixed-width parser per width */
+#define FIXED_TEST_CASES 2000
+
+/* Longest buffer fed to the reduction kernels, past several AVX2 loops */
+#define KERNEL_TEST_LENGTH 72
+
+/* Random buffers fed to the reduction kernels per length */
+#define KERNEL_TEST_CASES 50
+
+/* Elements of the array split by the parallel test, an uneven multiple */
+#define PARALLEL_TEST_LENGTH (5 * PARALLEL_MIN_CHUNK + 123)
+
+/**
+ * @brief Record of the chunks visited by `test_parallel`.
+ */
+typedef struct
+{
+    int  *visits;   /**< Number of times each index was visited. */
+    bool *b_starts; /**< Whether a chunk started at each index. */
+} ParallelVisits;
+
+/* Length of the line that outgrows a stream's first chunk */
+#define STREAM_TEST_LONG (INPUT_STREAM_CHUNK + 5000)
+
 /* Function prototypes */
 static void test_one(void);
 static void test_two(void);
 static void test_three(void);
 static void test_four(void);
 static void test_five(void);
+static void test_parse(void);
+static void test_parse_fixed(void);
+static void test_cursor(void);
+static void test_input_pipe(void);
+static void *pipe_writer(void *arg);
+static bool b_write_all(int fd, const char *data, size_t len);
+static void pipe_drain(int fd);
+static bool b_span_is(Span span, const char *text);
+static void test_kernels(void);
+static int  kernel_test_value(void);
+static void test_parallel(void);
+static void parallel_visit(const Array *array, int start, int end, void *ctx);
+static long long parallel_sum(const Array *array,
+                              int          start,
+                              int          end,
+                              void        *ctx);
+static long long parallel_span(const Array *array,
+                               int          start,
+                               int          end,
+                               void        *ctx);
+static long long parallel_join(long long lhs, long long rhs);
+static void test_sort(void);
+static void test_array_move(void);
+static void test_table_rows(void);
+static void test_table_push(void);
+static bool b_row_text(const Table *table, int row, const char *text);
+static void test_histogram(void);
+static void test_bounds(void);
+static void check_bounds(const Array *array, int key);
+static void test_grid(void);
+static void test_table_transforms(void);
+static void test_bitmatrix(void);
+static int  bitmatrix_count(const BitMatrix *matrix);
+static void test_graph_topology(void);
+static void test_graph_search(void);
+static int  maze_neighbours(int node, int *neighbours, int *weights, void *ctx);
+static long long maze_distance(int node, int goal, void *ctx);
+static void fill_array(Array *array, int count, int base);
+static bool b_array_holds(const Array *array, int count, int base);
+static bool b_row_holds(const Table *table, int row, int base);
+static int  compare_int(const void *lhs, const void *rhs);
+static int  compare_pair_key(const void *lhs, const void *rhs);
 
 /**
  * @brief Main function to initialize and execute CUnit tests.
@@ -79,6 +196,92 @@ main (void)
         ERROR_LOG("Failed CU_add_test: unable to add test_five");
     }
 
+    if (NULL == CU_add_test(suite, "test_parse", test_parse))
+    {
+        ERROR_LOG("Failed CU_add_test: unable to add test_parse");
+    }
+
+    if (NULL == CU_add_test(suite, "test_parse_fixed", test_parse_fixed))
+    {
+        ERROR_LOG("Failed CU_add_test: unable to add test_parse_fixed");
+    }
+
+    if (NULL == CU_add_test(suite, "test_cursor", test_cursor))
+    {
+        ERROR_LOG("Failed CU_add_test: unable to add test_cursor");
+    }
+
+    if (NULL == CU_add_test(suite, "test_input_pipe", test_input_pipe))
+    {
+        ERROR_LOG("Failed CU_add_test: unable to add test_input_pipe");
+    }
+
+    if (NULL == CU_add_test(suite, "test_kernels", test_kernels))
+    {
+        ERROR_LOG("Failed CU_add_test: unable to add test_kernels");
+    }
+
+    if (NULL == CU_add_test(suite, "test_parallel", test_parallel))
+    {
+        ERROR_LOG("Failed CU_add_test: unable to add test_parallel");
+    }
+
+    if (NULL == CU_add_test(suite, "test_sort", test_sort))
+    {
+        ERROR_LOG("Failed CU_add_test: unable to add test_sort");
+    }
+
+    if (NULL == CU_add_test(suite, "test_array_move", test_array_move))
+    {
+        ERROR_LOG("Failed CU_add_test: unable to add test_array_move");
+    }
+
+    if (NULL == CU_add_test(suite, "test_table_rows", test_table_rows))
+    {
+        ERROR_LOG("Failed CU_add_test: unable to add test_table_rows");
+    }
+
+    if (NULL == CU_add_test(suite, "test_table_push", test_table_push))
+    {
+        ERROR_LOG("Failed CU_add_test: unable to add test_table_push");
+    }
+
+    if (NULL == CU_add_test(suite, "test_histogram", test_histogram))
+    {
+        ERROR_LOG("Failed CU_add_test: unable to add test_histogram");
+    }
+
+    if (NULL == CU_add_test(suite, "test_bounds", test_bounds))
+    {
+        ERROR_LOG("Failed CU_add_test: unable to add test_bounds");
+    }
+
+    if (NULL == CU_add_test(suite, "test_grid", test_grid))
+    {
+        ERROR_LOG("Failed CU_add_test: unable to add test_grid");
+    }
+
+    if (NULL
+        == CU_add_test(suite, "test_table_transforms", test_table_transforms))
+    {
+        ERROR_LOG("Failed CU_add_test: unable to add test_table_transforms");
+    }
+
+    if (NULL == CU_add_test(suite, "test_bitmatrix", test_bitmatrix))
+    {
+        ERROR_LOG("Failed CU_add_test: unable to add test_bitmatrix");
+    }
+
+    if (NULL == CU_add_test(suite, "test_graph_topology", test_graph_topology))
+    {
+        ERROR_LOG("Failed CU_add_test: unable to add test_graph_topology");
+    }
+
+    if (NULL == CU_add_test(suite, "test_graph_search", test_graph_search))
+    {
+        ERROR_LOG("Failed CU_add_test: unable to add test_graph_search");
+    }
+
     retval = CU_basic_run_tests();
     if (CUE_SUCCESS != retval)
     {
@@ -158,12 +361,1759 @@ test_four (void)
 static void
 test_five (void)
 {
-    int expected_result[] = { 143, 0 }; /**< Expected results for comparison */
-    int actual_result[]   = { 0, 0 };   /**< Array to store actual results */
+    int expected_result[] = { 143, 123 }; /**< Expected results */
+    int actual_result[]   = { 0, 0 };     /**< Actual results */
 
     CU_ASSERT_EQUAL_FATAL(day_5("data/example_5.txt", actual_result), 0);
     CU_ASSERT_EQUAL_FATAL(actual_result[0], expected_result[0]);
     CU_ASSERT_EQUAL_FATAL(actual_result[1], expected_result[1]);
+
+    // The single rule 22|33 cannot order 11,33,44,22 through a sort
+    CU_ASSERT_EQUAL(day_5("data/partial_5.txt", actual_result),
+                    ERROR_INVALID_INPUT);
+}
+
+/**
+ * @brief Differential test of `parse_long` and `parse_int` against
+ * `strtol`.
+ *
+ * Random strings of mostly digits, with signs, spaces and letters mixed in
+ * and runs long enough to overflow, are parsed by all three. The value, the
+ * end pointer and the overflow report must agree, with `parse_int`
+ * saturating to the `int` range. Only part of each string is handed to the
+ * parsers, to check that they stop at their end bound. The strings around
+ * the `int` limits are checked on their own, since random ones rarely land
+ * on them.
+ */
+static void
+test_parse (void)
+{
+    const char  extras[] = "+- x";
+    const char *limits[] = { "2147483647",  "2147483648", "-2147483648",
+                             "-2147483649", "-0",         "+0",
+                             "00000000000000000002147483647" };
+    const int   num_limits = (int)(sizeof(limits) / sizeof(limits[0]));
+
+    srand(2024);
+
+    for (int test = 0; test < PARSE_TEST_CASES + num_limits; test++)
+    {
+        char text[PARSE_TEST_LENGTH + 1] = { 0 };
+        char copy[PARSE_TEST_LENGTH + 1] = { 0 };
+        int  len                         = rand() % (PARSE_TEST_LENGTH + 1);
+
+        for (int idx = 0; idx < len; idx++)
+        {
+            text[idx] = (0 != rand() % 8) ? (char)('0' + rand() % 10)
+                                          : extras[rand() % 4];
+        }
+
+        if (PARSE_TEST_CASES <= test)
+        {
+            memset(text, 0, sizeof(text));
+            strcpy(text, limits[test - PARSE_TEST_CASES]);
+            len = (int)strlen(text);
+        }
+
+        // strtol would skip leading whitespace, which parse_long does not
+        if (' ' == text[0])
+        {
+            text[0] = '7';
+        }
+
+        int bound = (PARSE_TEST_CASES <= test) ? len : rand() % (len + 1);
+        memcpy(copy, text, (size_t)bound);
+
+        char *ref_end = NULL;
+
+        errno = 0;
+
+        long ref     = strtol(copy, &ref_end, 10);
+        bool b_range = (ERANGE == errno);
+
+        long        value  = 0;
+        const char *next   = NULL;
+        int         status = parse_long(text, text + bound, &value, &next);
+
+        int         small        = 0;
+        const char *small_next   = NULL;
+        int         small_status = parse_int(
+            text, text + bound, &small, &small_next);
+
+        CU_ASSERT_EQUAL_FATAL(next - text, ref_end - copy);
+        CU_ASSERT_EQUAL_FATAL(small_next - text, ref_end - copy);
+
+        if (ref_end == copy)
+        {
+            CU_ASSERT_EQUAL_FATAL(status, ERROR_INVALID_INPUT);
+            CU_ASSERT_EQUAL_FATAL(small_status, ERROR_INVALID_INPUT);
+            continue;
+        }
+
+        CU_ASSERT_EQUAL_FATAL(value, ref);
+        CU_ASSERT_EQUAL_FATAL(status,
+                              b_range ? ERROR_OUT_OF_RANGE : ERROR_SUCCESS);
+
+        long clamped = (INT_MIN > ref) ? INT_MIN : ref;
+
+        clamped = (INT_MAX < clamped) ? INT_MAX : clamped;
+
+        CU_ASSERT_EQUAL_FATAL(small, clamped);
+        CU_ASSERT_EQUAL_FATAL(small_status,
+                              (b_range || (clamped != ref))
+                                  ? ERROR_OUT_OF_RANGE
+                                  : ERROR_SUCCESS);
+    }
+}
+
+/**
+ * @brief Randomized test of `parse_fixed`.
+ *
+ * Fields of every width, often with leading zeros, are parsed both with 16
+ * readable bytes after them, which takes the SSE4.1 path when it is built
+ * in, and at the very end of the buffer, which takes the scalar loop. A
+ * field with a non-digit inside its width, or a digit right after it, must
+ * be rejected; the non-digits include the characters next to '0' and '9'.
+ */
+static void
+test_parse_fixed (void)
+{
+    const char bad[] = { '/', ':', ' ', '\n', '-', 'x', '\0', (char)0xB0 };
+
+    srand(2024);
+
+    for (int width = 1; width <= PARSE_FIXED_MAX_WIDTH; width++)
+    {
+        for (int test = 0; test < FIXED_TEST_CASES; test++)
+        {
+            char      buffer[2 * PARSE_FIXED_MAX_WIDTH] = { 0 };
+            char     *field    = buffer;
+            long long expected = 0;
+            long long value    = -1;
+
+            // Place the field at the start or flush against the end
+            if (0 == test % 2)
+            {
+                field = buffer + sizeof(buffer) - width;
+            }
+
+            for (int idx = 0; idx < width; idx++)
+            {
+                int digit = (0 == rand() % 3) ? 0 : rand() % 10;
+
+                field[idx] = (char)('0' + digit);
+                expected   = expected * 10 + digit;
+            }
+
+            const char *end = buffer + sizeof(buffer);
+
+            if ((buffer == field) && (0 == test % 4))
+            {
+                field[width] = bad[rand() % (int)sizeof(bad)];
+            }
+
+            CU_ASSERT_EQUAL_FATAL(parse_fixed(field, end, width, &value),
+                                  ERROR_SUCCESS);
+            CU_ASSERT_EQUAL_FATAL(value, expected);
+
+            // A bad character anywhere inside the width
+            char saved = field[test % width];
+
+            field[test % width] = bad[rand() % (int)sizeof(bad)];
+            CU_ASSERT_EQUAL_FATAL(parse_fixed(field, end, width, &value),
+                                  ERROR_INVALID_INPUT);
+            field[test % width] = saved;
+
+            // A digit right after the width makes the field too wide
+            if (buffer == field)
+            {
+                field[width] = (char)('0' + rand() % 10);
+                CU_ASSERT_EQUAL_FATAL(parse_fixed(field, end, width, &value),
+                                      ERROR_INVALID_INPUT);
+            }
+        }
+
+        // Too few characters left for the width
+        long long value = 0;
+
+        CU_ASSERT_EQUAL(parse_fixed("12", "12" + 2, width + 2, &value),
+                        ERROR_INVALID_INPUT);
+    }
+
+    long long value = 0;
+
+    CU_ASSERT_EQUAL(parse_fixed("1", "1" + 1, 0, &value), ERROR_INVALID_INPUT);
+    CU_ASSERT_EQUAL(parse_fixed("12345678901234567", "12345678901234567" + 17,
+                                PARSE_FIXED_MAX_WIDTH + 1, &value),
+                    ERROR_INVALID_INPUT);
+}
+
+/**
+ * @brief Checks that a span holds exactly `text`.
+ */
+static bool
+b_span_is (Span span, const char *text)
+{
+    size_t len = strlen(text);
+
+    return (len == span.len) && (0 == memcmp(span.data, text, len));
+}
+
+/**
+ * @brief Test case for the `Cursor` line, field, integer and literal reads.
+ *
+ * Failed reads must leave the cursor where the header says: after the
+ * leading whitespace for an integer, and untouched for a literal.
+ */
+static void
+test_cursor (void)
+{
+    const char text[]
+        = "  -x +7 -2147483648 2147483648 mul(3,4)mu\na,,b,\r\nlast\r";
+    Cursor cursor = cursor_initialization(text, sizeof(text) - 1);
+    Span   line;
+    Span   field;
+    int    value = 0;
+
+    // A sign with no digits is rejected after the whitespace is skipped
+    CU_ASSERT_FALSE(cursor_next_int(&cursor, &value));
+    CU_ASSERT_PTR_EQUAL_FATAL(cursor.pos, text + 2);
+    CU_ASSERT_TRUE(cursor_match(&cursor, "-x"));
+    CU_ASSERT_TRUE(cursor_next_int(&cursor, &value));
+    CU_ASSERT_EQUAL(value, 7);
+    CU_ASSERT_TRUE(cursor_next_int(&cursor, &value));
+    CU_ASSERT_EQUAL(value, INT_MIN);
+
+    // One past INT_MAX overflows and is left in place
+    CU_ASSERT_FALSE(cursor_next_int(&cursor, &value));
+    CU_ASSERT_TRUE(cursor_match(&cursor, "2147483648 "));
+
+    // A partial match, even one cut short by the line, moves nothing
+    const char *start = cursor.pos;
+
+    CU_ASSERT_FALSE(cursor_match(&cursor, "mul(3,5)"));
+    CU_ASSERT_PTR_EQUAL(cursor.pos, start);
+    CU_ASSERT_TRUE(cursor_match(&cursor, "mul("));
+    CU_ASSERT_TRUE(cursor_next_int(&cursor, &value));
+    CU_ASSERT_TRUE(cursor_match(&cursor, ","));
+    CU_ASSERT_TRUE(cursor_next_int(&cursor, &value));
+    CU_ASSERT_EQUAL(value, 4);
+    CU_ASSERT_TRUE(cursor_match(&cursor, ")"));
+
+    Cursor short_cursor = cursor_initialization(cursor.pos, 2);
+
+    CU_ASSERT_FALSE(cursor_match(&short_cursor, "mul("));
+    CU_ASSERT_PTR_EQUAL(short_cursor.pos, cursor.pos);
+
+    // The rest reads as lines; the last has a "\r" but no newline
+    CU_ASSERT_TRUE(cursor_next_line(&cursor, &line));
+    CU_ASSERT_TRUE(b_span_is(line, "mu"));
+    CU_ASSERT_TRUE(cursor_next_line(&cursor, &line));
+    CU_ASSERT_TRUE(b_span_is(line, "a,,b,"));
+    CU_ASSERT_TRUE(cursor_next_line(&cursor, &field));
+    CU_ASSERT_TRUE(b_span_is(field, "last"));
+    CU_ASSERT_FALSE(cursor_next_line(&cursor, &field));
+    CU_ASSERT_TRUE(cursor_at_end(&cursor));
+
+    // Empty fields between delimiters are kept; a trailing one ends the line
+    const char *fields[] = { "a", "", "b" };
+    Cursor      row      = cursor_from_span(line);
+
+    for (int idx = 0; idx < 3; idx++)
+    {
+        CU_ASSERT_TRUE_FATAL(cursor_next_field(&row, ',', &field));
+        CU_ASSERT_TRUE(b_span_is(field, fields[idx]));
+    }
+
+    CU_ASSERT_FALSE(cursor_next_field(&row, ',', &field));
+    CU_ASSERT_FALSE(cursor_next_int(&row, &value));
+}
+
+/**
+ * @brief Writes a whole buffer to a descriptor.
+ *
+ * @return `true` if every byte was written, `false` otherwise.
+ */
+static bool
+b_write_all (int fd, const char *data, size_t len)
+{
+    while (0 < len)
+    {
+        ssize_t count = write(fd, data, len);
+
+        if ((0 > count) && (EINTR == errno))
+        {
+            continue;
+        }
+
+        if (0 > count)
+        {
+            return false;
+        }
+
+        data += count;
+        len -= (size_t)count;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Waits until the reader has taken every byte out of a pipe.
+ *
+ * The next write then starts a new read on the other end, which pins the
+ * reader's chunk boundary to this point in the data.
+ */
+static void
+pipe_drain (int fd)
+{
+    struct timespec pause = { 0, 100000 };
+    int             left  = 0;
+
+    while ((0 == ioctl(fd, FIONREAD, &left)) && (0 < left))
+    {
+        nanosleep(&pause, NULL);
+    }
+}
+
+/**
+ * @brief Feeds the lines of `test_input_pipe` into a pipe, then closes it.
+ *
+ * @param arg Pointer to the write end of the pipe.
+ * @return Always NULL.
+ */
+static void *
+pipe_writer (void *arg)
+{
+    int         fd       = *(int *)arg;
+    size_t      len      = 6 + STREAM_TEST_LONG + 1;
+    char       *text     = malloc(len);
+    const char *chunks[] = { "boundary\n", "carried\nspl", "it\r",
+                             "\nnext\r\n", "last" };
+
+    // The first write is atomic, so the first chunk ends inside the long
+    // line and its start is carried over behind "first"
+    if (NULL != text)
+    {
+        memcpy(text, "first\n", 6);
+
+        for (int idx = 0; idx < STREAM_TEST_LONG; idx++)
+        {
+            text[6 + idx] = (char)('a' + idx % 26);
+        }
+
+        text[len - 1] = '\n';
+        (void)b_write_all(fd, text, PIPE_BUF);
+        pipe_drain(fd);
+        (void)b_write_all(fd, text + PIPE_BUF, len - PIPE_BUF);
+        free(text);
+    }
+
+    // A chunk that ends on a newline, one that carries a partial line, a
+    // "\r\n" split across two chunks and a last line with no newline
+    for (int idx = 0; idx < 5; idx++)
+    {
+        pipe_drain(fd);
+        (void)b_write_all(fd, chunks[idx], strlen(chunks[idx]));
+    }
+
+    close(fd);
+    return NULL;
+}
+
+/**
+ * @brief Test case for `input_open_stream` over a pipe on standard input.
+ *
+ * A pipe is never mapped, so it is read in chunks with partial lines
+ * carried over. The writer waits for the pipe to empty before each case, so
+ * the chunk boundaries fall exactly where the cases need them: inside a
+ * line longer than `INPUT_STREAM_CHUNK`, right after a newline, inside a
+ * line that follows a whole one, between a "\r" and its "\n", and before a
+ * last line with no newline.
+ */
+static void
+test_input_pipe (void)
+{
+    const char *lines[] = { "boundary", "carried", "split", "next", "last" };
+    int         fds[2]  = { -1, -1 };
+    int         saved   = dup(STDIN_FILENO);
+    pthread_t   writer;
+    Span        line;
+
+    CU_ASSERT_FATAL(0 <= saved);
+    CU_ASSERT_EQUAL_FATAL(pipe(fds), 0);
+    CU_ASSERT_FATAL(0 <= dup2(fds[0], STDIN_FILENO));
+    close(fds[0]);
+
+    // The input keeps its own duplicate, so standard input can go back now
+    Input *input = input_open_stream(INPUT_STDIN);
+
+    dup2(saved, STDIN_FILENO);
+    close(saved);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(input);
+    CU_ASSERT_EQUAL_FATAL(pthread_create(&writer, NULL, pipe_writer, &fds[1]),
+                          0);
+
+    // Every line is read even after a failed check, so the writer finishes
+    CU_ASSERT_TRUE(input_next_line(input, &line));
+    CU_ASSERT_TRUE(b_span_is(line, "first"));
+    CU_ASSERT_TRUE(input_next_line(input, &line));
+    CU_ASSERT_EQUAL(line.len, STREAM_TEST_LONG);
+
+    for (size_t idx = 0; idx < line.len; idx++)
+    {
+        if ((char)('a' + idx % 26) != line.data[idx])
+        {
+            CU_ASSERT_EQUAL(idx, line.len);
+            break;
+        }
+    }
+
+    for (int idx = 0; idx < 5; idx++)
+    {
+        CU_ASSERT_TRUE(input_next_line(input, &line));
+        CU_ASSERT_TRUE(b_span_is(line, lines[idx]));
+    }
+
+    CU_ASSERT_FALSE(input_next_line(input, &line));
+    CU_ASSERT_EQUAL(input->status, ERROR_SUCCESS);
+    pthread_join(writer, NULL);
+    input_close(input);
+}
+
+/**
+ * @brief Draws an int for the kernel test, often one of the extremes.
+ *
+ * @return INT_MIN, INT_MAX, a value next to 0, or a random 31-bit value.
+ */
+static int
+kernel_test_value (void)
+{
+    const int extremes[] = { INT_MIN, INT_MIN + 1, INT_MAX, -1, 0, 1 };
+
+    if (0 == rand() % 3)
+    {
+        return extremes[rand() % 6];
+    }
+
+    return rand() - RAND_MAX / 2;
+}
+
+/**
+ * @brief Differential test of the reduction kernels against scalar loops.
+ *
+ * Every length from 0 up to several whole AVX2 registers is tried, so the
+ * vector loops run with every tail length, and the buffers start at varying
+ * offsets. The multipliers are small except at one position, so a single
+ * product of two extremes is covered without overflowing the 64-bit sum.
+ * Build with `ARCH_FLAGS` empty, `-msse2` and `-mavx2` to cover each path.
+ */
+static void
+test_kernels (void)
+{
+    int a[KERNEL_TEST_LENGTH + 3];
+    int b[KERNEL_TEST_LENGTH + 3];
+    int mask[KERNEL_TEST_LENGTH + 3];
+
+    srand(2024);
+
+    for (int len = 0; len <= KERNEL_TEST_LENGTH; len++)
+    {
+        for (int test = 0; test < KERNEL_TEST_CASES; test++)
+        {
+            int offset = test % 4;
+
+            for (int idx = 0; idx < len + offset; idx++)
+            {
+                a[idx]    = kernel_test_value();
+                b[idx]    = rand() % 2001 - 1000;
+                mask[idx] = (0 == rand() % 2) ? 0 : kernel_test_value();
+            }
+
+            if (0 < len)
+            {
+                b[offset + rand() % len] = kernel_test_value();
+            }
+
+            const int *pa       = a + offset;
+            const int *pb       = b + offset;
+            const int *pm       = mask + offset;
+            long long  sum      = 0;
+            long long  dot      = 0;
+            long long  masked   = 0;
+            long long  sad      = 0;
+            int        smallest = INT_MAX;
+            int        largest  = INT_MIN;
+
+            for (int idx = 0; idx < len; idx++)
+            {
+                long long product = (long long)pa[idx] * pb[idx];
+
+                sum += pa[idx];
+                dot += product;
+                masked += (0 != pm[idx]) ? product : 0;
+                sad += llabs((long long)pa[idx] - pb[idx]);
+                smallest = (pa[idx] < smallest) ? pa[idx] : smallest;
+                largest  = (pa[idx] > largest) ? pa[idx] : largest;
+            }
+
+            CU_ASSERT_EQUAL_FATAL(kernel_sum_int(pa, len), sum);
+            CU_ASSERT_EQUAL_FATAL(kernel_dot_int(pa, pb, len), dot);
+            CU_ASSERT_EQUAL_FATAL(kernel_dot_int(pb, pa, len), dot);
+            CU_ASSERT_EQUAL_FATAL(kernel_dot_masked_int(pa, pb, pm, len),
+                                  masked);
+            CU_ASSERT_EQUAL_FATAL(kernel_sad_int(pa, pb, len), sad);
+            CU_ASSERT_EQUAL_FATAL(kernel_sad_int(pb, pa, len), sad);
+            CU_ASSERT_EQUAL_FATAL(kernel_min_int(pa, len), smallest);
+            CU_ASSERT_EQUAL_FATAL(kernel_max_int(pa, len), largest);
+        }
+    }
+}
+
+/**
+ * @brief Test of `array_parallel_for` and `array_parallel_reduce`.
+ *
+ * The thread count is forced so that worker threads start even on a single
+ * processor. Every index must be visited exactly once, the chunks must be
+ * as many as the threads allow, and the reductions must match a serial
+ * loop. The span reduction only combines chunks that are adjacent and in
+ * order, so it also shows that the custom combine function is applied.
+ */
+static void
+test_parallel (void)
+{
+    const int      threads[] = { 1, 2, 3, 4, 7 };
+    Array         *array     = array_initialization(TYPE_INT);
+    int           *visits    = calloc(PARALLEL_TEST_LENGTH, sizeof(int));
+    bool          *b_starts  = calloc(PARALLEL_TEST_LENGTH, sizeof(bool));
+    ParallelVisits record    = { visits, b_starts };
+    long long      expected  = 0;
+
+    CU_ASSERT_PTR_NOT_NULL_FATAL(array);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(visits);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(b_starts);
+
+    for (int idx = 0; idx < PARALLEL_TEST_LENGTH; idx++)
+    {
+        int value = idx % 2001 - 1000;
+
+        CU_ASSERT_EQUAL_FATAL(array_add(array, &value), ERROR_SUCCESS);
+        expected += value;
+    }
+
+    for (int test = 0; test < 5; test++)
+    {
+        int       num_chunks = 0;
+        long long result     = 0;
+
+        parallel_set_thread_count(threads[test]);
+        memset(visits, 0, PARALLEL_TEST_LENGTH * sizeof(int));
+        memset(b_starts, 0, PARALLEL_TEST_LENGTH * sizeof(bool));
+
+        CU_ASSERT_EQUAL(array_parallel_for(array, parallel_visit, &record),
+                        ERROR_SUCCESS);
+
+        for (int idx = 0; idx < PARALLEL_TEST_LENGTH; idx++)
+        {
+            CU_ASSERT_EQUAL_FATAL(visits[idx], 1);
+            num_chunks += (true == b_starts[idx]) ? 1 : 0;
+        }
+
+        CU_ASSERT_EQUAL(num_chunks, (5 < threads[test]) ? 5 : threads[test]);
+
+        CU_ASSERT_EQUAL(
+            array_parallel_reduce(array, parallel_sum, NULL, NULL, &result),
+            ERROR_SUCCESS);
+        CU_ASSERT_EQUAL(result, expected);
+
+        CU_ASSERT_EQUAL(array_parallel_reduce(
+                            array, parallel_span, parallel_join, NULL, &result),
+                        ERROR_SUCCESS);
+        CU_ASSERT_EQUAL(result, PARALLEL_TEST_LENGTH);
+    }
+
+    parallel_set_thread_count(0);
+    free(b_starts);
+    free(visits);
+    array_destroy(array);
+}
+
+/**
+ * @brief Counts a visit to every index of a chunk and marks its start.
+ */
+static void
+parallel_visit (const Array *array, int start, int end, void *ctx)
+{
+    ParallelVisits *record = ctx;
+
+    (void)array;
+    record->b_starts[start] = true;
+
+    for (int idx = start; idx < end; idx++)
+    {
+        record->visits[idx]++;
+    }
+}
+
+/**
+ * @brief Sums the ints of a chunk.
+ */
+static long long
+parallel_sum (const Array *array, int start, int end, void *ctx)
+{
+    const int *data  = array->data;
+    long long  total = 0;
+
+    (void)ctx;
+
+    for (int idx = start; idx < end; idx++)
+    {
+        total += data[idx];
+    }
+
+    return total;
+}
+
+/**
+ * @brief Reduces a chunk to its range, packed as `start << 32 | end`.
+ */
+static long long
+parallel_span (const Array *array, int start, int end, void *ctx)
+{
+    (void)array;
+    (void)ctx;
+    return ((long long)start << 32) | end;
+}
+
+/**
+ * @brief Joins two packed ranges if the second follows the first.
+ *
+ * @return The joined range, or -1 if the ranges are not adjacent.
+ */
+static long long
+parallel_join (long long lhs, long long rhs)
+{
+    if ((0 > lhs) || (0 > rhs) || ((lhs & 0xFFFFFFFF) != (rhs >> 32)))
+    {
+        return -1;
+    }
+
+    return (lhs & ~0xFFFFFFFFLL) | (rhs & 0xFFFFFFFF);
+}
+
+/**
+ * @brief Orders two ints ascending, as a reference for the radix sort.
+ */
+static int
+compare_int (const void *lhs, const void *rhs)
+{
+    int left  = *(const int *)lhs;
+    int right = *(const int *)rhs;
+
+    return (left > right) - (left < right);
+}
+
+/**
+ * @brief Orders two (key, position) pairs by key only.
+ */
+static int
+compare_pair_key (const void *lhs, const void *rhs)
+{
+    return compare_int(lhs, rhs);
+}
+
+/**
+ * @brief Test case for the integer and stable sorts and `array_argsort`.
+ *
+ * Mixed-sign keys spanning the whole `int` range go through the radix sort
+ * of `array_sort` and `array_sort_stable` and are checked against `qsort`.
+ * Keys drawn from a handful of negative and positive values then check
+ * that `array_argsort` and the comparator merge sort keep equal keys in
+ * their original order.
+ */
+static void
+test_sort (void)
+{
+    int   *expected = malloc(SORT_TEST_CASES * sizeof(int));
+    Array *values   = array_initialization(TYPE_INT);
+    Array *keys     = array_initialization(TYPE_INT);
+    Array *indices  = array_initialization(TYPE_INT);
+    Array *pairs    = array_initialization_custom(2 * sizeof(int));
+
+    CU_ASSERT_PTR_NOT_NULL_FATAL(expected);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(values);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(keys);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(indices);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(pairs);
+
+    srand(2024);
+
+    for (int pass = 0; pass < 2; pass++)
+    {
+        array_reset(values);
+
+        for (int idx = 0; idx < SORT_TEST_CASES; idx++)
+        {
+            unsigned int bits = ((unsigned int)rand() << 16)
+                                ^ (unsigned int)rand();
+            int          value;
+
+            // Mix in the extremes and small values of either sign
+            switch (idx % 8)
+            {
+                case 0:
+                    value = INT_MIN + idx % 3;
+                    break;
+                case 1:
+                    value = INT_MAX - idx % 3;
+                    break;
+                case 2:
+                    value = rand() % 201 - 100;
+                    break;
+                default:
+                    memcpy(&value, &bits, sizeof(value));
+                    break;
+            }
+
+            expected[idx] = value;
+            CU_ASSERT_EQUAL_FATAL(array_add(values, &value), ERROR_SUCCESS);
+        }
+
+        qsort(expected, SORT_TEST_CASES, sizeof(int), compare_int);
+
+        int status = (0 == pass) ? array_sort(values, NULL)
+                                 : array_sort_stable(values, NULL);
+
+        CU_ASSERT_EQUAL_FATAL(status, ERROR_SUCCESS);
+        CU_ASSERT_EQUAL_FATAL(
+            memcmp(values->data, expected, SORT_TEST_CASES * sizeof(int)), 0);
+    }
+
+    for (int idx = 0; idx < SORT_TEST_CASES; idx++)
+    {
+        int pair[2] = { rand() % 9 - 4, idx };
+
+        CU_ASSERT_EQUAL_FATAL(array_add(keys, &pair[0]), ERROR_SUCCESS);
+        CU_ASSERT_EQUAL_FATAL(array_add(pairs, pair), ERROR_SUCCESS);
+    }
+
+    CU_ASSERT_EQUAL_FATAL(array_argsort(keys, indices), ERROR_SUCCESS);
+    CU_ASSERT_EQUAL_FATAL(array_sort_stable(pairs, compare_pair_key),
+                          ERROR_SUCCESS);
+    CU_ASSERT_EQUAL_FATAL(indices->idx, SORT_TEST_CASES);
+
+    for (int idx = 1; idx < SORT_TEST_CASES; idx++)
+    {
+        int prev = ARRAY_AT(indices, int, idx - 1);
+        int curr = ARRAY_AT(indices, int, idx);
+        int diff = ARRAY_AT(keys, int, curr) - ARRAY_AT(keys, int, prev);
+
+        CU_ASSERT_FATAL((0 < diff) || ((0 == diff) && (prev < curr)));
+
+        const int *lhs = array_get(pairs, idx - 1);
+        const int *rhs = array_get(pairs, idx);
+
+        CU_ASSERT_FATAL((lhs[0] < rhs[0])
+                        || ((lhs[0] == rhs[0]) && (lhs[1] < rhs[1])));
+
+        // The merge sort and the argsort must agree on the permutation
+        CU_ASSERT_EQUAL_FATAL(rhs[1], curr);
+    }
+
+    // The keys themselves are left in their original order
+    for (int idx = 0; idx < SORT_TEST_CASES; idx++)
+    {
+        const int *pair = array_get(pairs, idx);
+
+        CU_ASSERT_EQUAL_FATAL(pair[0], ARRAY_AT(keys, int, pair[1]));
+    }
+
+    free(expected);
+    array_destroy(values);
+    array_destroy(keys);
+    array_destroy(indices);
+    array_destroy(pairs);
+}
+
+/**
+ * @brief Appends `base, base + 1, ...` to an integer array.
+ */
+static void
+fill_array (Array *array, int count, int base)
+{
+    for (int idx = 0; idx < count; idx++)
+    {
+        int value = base + idx;
+
+        CU_ASSERT_EQUAL_FATAL(array_add(array, &value), ERROR_SUCCESS);
+    }
+}
+
+/**
+ * @brief Checks that an integer array holds exactly `base, base + 1, ...`.
+ */
+static bool
+b_array_holds (const Array *array, int count, int base)
+{
+    if (count != array->idx)
+    {
+        return false;
+    }
+
+    for (int idx = 0; idx < count; idx++)
+    {
+        if (base + idx != ARRAY_AT(array, int, idx))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/**
+ * @brief Checks that a table row holds `MOVE_TEST_HEAP` values from `base`.
+ */
+static bool
+b_row_holds (const Table *table, int row, int base)
+{
+    return b_array_holds(table_get_row(table, row), MOVE_TEST_HEAP, base);
+}
+
+/**
+ * @brief Test case for `array_swap` and `array_move`.
+ *
+ * Arrays are set up in caller-owned storage so that short ones keep their
+ * elements inline. After every exchange an inline array must point at its
+ * own inline buffer, never at the other structure's, and a moved-from
+ * array must be empty and usable without touching the moved contents.
+ */
+static void
+test_array_move (void)
+{
+    Array small;
+    Array large;
+
+    CU_ASSERT_EQUAL_FATAL(array_init(&small, TYPE_INT), ERROR_SUCCESS);
+    CU_ASSERT_EQUAL_FATAL(array_init(&large, TYPE_INT), ERROR_SUCCESS);
+    fill_array(&small, 3, 10);
+    fill_array(&large, MOVE_TEST_HEAP, 1000);
+    CU_ASSERT_PTR_EQUAL_FATAL(small.data, small.inline_buf.bytes);
+    CU_ASSERT_PTR_NOT_EQUAL_FATAL(large.data, large.inline_buf.bytes);
+
+    // Inline with heap-backed, both ways
+    const void *heap = large.data;
+
+    CU_ASSERT_EQUAL_FATAL(array_swap(&small, &large), ERROR_SUCCESS);
+    CU_ASSERT_PTR_EQUAL_FATAL(small.data, heap);
+    CU_ASSERT_PTR_EQUAL_FATAL(large.data, large.inline_buf.bytes);
+    CU_ASSERT_FATAL(b_array_holds(&small, MOVE_TEST_HEAP, 1000));
+    CU_ASSERT_FATAL(b_array_holds(&large, 3, 10));
+
+    CU_ASSERT_EQUAL_FATAL(array_swap(&small, &large), ERROR_SUCCESS);
+    CU_ASSERT_PTR_EQUAL_FATAL(small.data, small.inline_buf.bytes);
+    CU_ASSERT_PTR_EQUAL_FATAL(large.data, heap);
+    CU_ASSERT_FATAL(b_array_holds(&small, 3, 10));
+    CU_ASSERT_FATAL(b_array_holds(&large, MOVE_TEST_HEAP, 1000));
+
+    // Two inline arrays exchange their bytes
+    Array other;
+
+    CU_ASSERT_EQUAL_FATAL(array_init(&other, TYPE_INT), ERROR_SUCCESS);
+    fill_array(&other, 5, 20);
+    CU_ASSERT_EQUAL_FATAL(array_swap(&small, &other), ERROR_SUCCESS);
+    CU_ASSERT_PTR_EQUAL_FATAL(small.data, small.inline_buf.bytes);
+    CU_ASSERT_PTR_EQUAL_FATAL(other.data, other.inline_buf.bytes);
+    CU_ASSERT_FATAL(b_array_holds(&small, 5, 20));
+    CU_ASSERT_FATAL(b_array_holds(&other, 3, 10));
+
+    // Moving an inline array copies it into the destination's own buffer
+    CU_ASSERT_EQUAL_FATAL(array_move(&large, &small), ERROR_SUCCESS);
+    CU_ASSERT_PTR_EQUAL_FATAL(large.data, large.inline_buf.bytes);
+    CU_ASSERT_PTR_EQUAL_FATAL(small.data, small.inline_buf.bytes);
+    CU_ASSERT_FATAL(b_array_holds(&large, 5, 20));
+    CU_ASSERT_EQUAL_FATAL(small.idx, 0);
+
+    fill_array(&small, MOVE_TEST_HEAP, 500);
+    CU_ASSERT_FATAL(b_array_holds(&large, 5, 20));
+    CU_ASSERT_FATAL(b_array_holds(&small, MOVE_TEST_HEAP, 500));
+
+    // Moving a heap-backed array hands its buffer over
+    heap = small.data;
+    CU_ASSERT_EQUAL_FATAL(array_move(&other, &small), ERROR_SUCCESS);
+    CU_ASSERT_PTR_EQUAL_FATAL(other.data, heap);
+    CU_ASSERT_PTR_EQUAL_FATAL(small.data, small.inline_buf.bytes);
+    CU_ASSERT_FATAL(b_array_holds(&other, MOVE_TEST_HEAP, 500));
+    CU_ASSERT_EQUAL_FATAL(small.idx, 0);
+
+    fill_array(&small, MOVE_TEST_HEAP, 7);
+    CU_ASSERT_FATAL(b_array_holds(&other, MOVE_TEST_HEAP, 500));
+    CU_ASSERT_FATAL(b_array_holds(&small, MOVE_TEST_HEAP, 7));
+
+    array_release(&small);
+    array_release(&large);
+    array_release(&other);
+}
+
+/**
+ * @brief Test case for `table_swap_rows` and `table_rotate_rows`.
+ *
+ * Row `r` starts out holding `r * 100, r * 100 + 1, ...`, so each row can
+ * be identified after the handles have been exchanged or rotated.
+ */
+static void
+test_table_rows (void)
+{
+    Table *table = table_initialization(TYPE_INT, 3);
+
+    CU_ASSERT_PTR_NOT_NULL_FATAL(table);
+
+    for (int row = 0; row < 3; row++)
+    {
+        fill_array(table_get_row(table, row), MOVE_TEST_HEAP, row * 100);
+    }
+
+    CU_ASSERT_EQUAL_FATAL(table_swap_rows(table, 0, 2), ERROR_SUCCESS);
+    CU_ASSERT_FATAL(b_row_holds(table, 0, 200));
+    CU_ASSERT_FATAL(b_row_holds(table, 1, 100));
+    CU_ASSERT_FATAL(b_row_holds(table, 2, 0));
+
+    CU_ASSERT_EQUAL_FATAL(table_rotate_rows(table), ERROR_SUCCESS);
+    CU_ASSERT_FATAL(b_row_holds(table, 0, 100));
+    CU_ASSERT_FATAL(b_row_holds(table, 1, 0));
+    CU_ASSERT_FATAL(b_row_holds(table, 2, 200));
+
+    // A swap after a rotation addresses logical rows, not slots
+    CU_ASSERT_EQUAL_FATAL(table_swap_rows(table, 1, 2), ERROR_SUCCESS);
+    CU_ASSERT_FATAL(b_row_holds(table, 1, 200));
+    CU_ASSERT_FATAL(b_row_holds(table, 2, 0));
+
+    CU_ASSERT_EQUAL_FATAL(table_rotate_rows(table), ERROR_SUCCESS);
+    CU_ASSERT_EQUAL_FATAL(table_rotate_rows(table), ERROR_SUCCESS);
+    CU_ASSERT_EQUAL_FATAL(table_rotate_rows(table), ERROR_SUCCESS);
+    CU_ASSERT_FATAL(b_row_holds(table, 0, 100));
+    CU_ASSERT_FATAL(b_row_holds(table, 1, 200));
+    CU_ASSERT_FATAL(b_row_holds(table, 2, 0));
+
+    CU_ASSERT_EQUAL(table_swap_rows(table, 0, 3), ERROR_INDEX_OUT_OF_BOUNDS);
+    CU_ASSERT_EQUAL(table_swap_rows(table, -1, 0), ERROR_INDEX_OUT_OF_BOUNDS);
+
+    table_destroy(table);
+}
+
+/**
+ * @brief Checks that a char table row holds exactly `text`.
+ */
+static bool
+b_row_text (const Table *table, int row, const char *text)
+{
+    const Array *array = table_get_row(table, row);
+    int          len   = (int)strlen(text);
+
+    return (NULL != array) && (len == array->idx)
+           && (0 == memcmp(array->data, text, (size_t)len));
+}
+
+/**
+ * @brief Test case for `table_set_row_from_buffer` and `table_push_row`.
+ *
+ * Only one trailing `\n`, `\r\n` or `\r` is dropped, and only from char
+ * rows. A pushed row must reuse the oldest row's storage, and a push that
+ * fails must leave every row in place.
+ */
+static void
+test_table_push (void)
+{
+    const char *lines[]    = { "abc\n", "def\r\n", "ghi\r", "x\n\n", "y\n\r",
+                               "\r\n",  "z" };
+    const char *expected[] = { "abc", "def", "ghi", "x\n", "y\n", "", "z" };
+    Table      *table      = table_initialization(TYPE_CHAR, 3);
+
+    CU_ASSERT_PTR_NOT_NULL_FATAL(table);
+
+    for (int idx = 0; idx < 7; idx++)
+    {
+        int len = (int)strlen(lines[idx]);
+
+        CU_ASSERT_EQUAL_FATAL(
+            table_set_row_from_buffer(table, idx % 3, lines[idx], len),
+            ERROR_SUCCESS);
+        CU_ASSERT_FATAL(b_row_text(table, idx % 3, expected[idx]));
+    }
+
+    CU_ASSERT_EQUAL(table_set_row_from_buffer(table, 3, "a", 1),
+                    ERROR_INDEX_OUT_OF_BOUNDS);
+
+    // Rows are now "z", "y\n" and ""; the oldest is recycled
+    Array *oldest = table_get_row(table, 0);
+
+    CU_ASSERT_EQUAL_FATAL(table_push_row(table, "jkl\r\n", 5), ERROR_SUCCESS);
+    CU_ASSERT_PTR_EQUAL_FATAL(table_get_row(table, 2), oldest);
+    CU_ASSERT_FATAL(b_row_text(table, 0, "y\n"));
+    CU_ASSERT_FATAL(b_row_text(table, 1, ""));
+    CU_ASSERT_FATAL(b_row_text(table, 2, "jkl"));
+
+    CU_ASSERT_EQUAL(table_push_row(table, "mno", -1), ERROR_INVALID_INPUT);
+    CU_ASSERT_EQUAL(table_push_row(table, NULL, 3), ERROR_NULL_POINTER);
+    CU_ASSERT_FATAL(b_row_text(table, 0, "y\n"));
+    CU_ASSERT_FATAL(b_row_text(table, 1, ""));
+    CU_ASSERT_FATAL(b_row_text(table, 2, "jkl"));
+
+    table_destroy(table);
+
+    // Int rows keep a trailing value that happens to equal '\n'
+    const int values[] = { 7, '\r', '\n' };
+
+    table = table_initialization(TYPE_INT, 1);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(table);
+    CU_ASSERT_EQUAL_FATAL(table_push_row(table, values, 3), ERROR_SUCCESS);
+    CU_ASSERT_EQUAL(table_get_row(table, 0)->idx, 3);
+    table_destroy(table);
+}
+
+/**
+ * @brief Test case for `array_histogram` over strided, sparse keys.
+ *
+ * Keys spaced a power of two apart share their low bits, which is the worst
+ * case for a hash that keeps the low bits of the product; an odd stride is
+ * checked alongside. Key `i` is counted `i % 3 + 1` times, and the values
+ * between keys must not be found.
+ */
+static void
+test_histogram (void)
+{
+    const int strides[] = { 65536, 4096, 65537 };
+
+    for (size_t test = 0; test < sizeof(strides) / sizeof(strides[0]); test++)
+    {
+        Array *values = array_initialization(TYPE_INT);
+
+        CU_ASSERT_PTR_NOT_NULL_FATAL(values);
+
+        for (int idx = 0; idx < HISTOGRAM_TEST_KEYS; idx++)
+        {
+            int key = (idx - HISTOGRAM_TEST_KEYS / 2) * strides[test];
+
+            for (int copy = 0; copy <= idx % 3; copy++)
+            {
+                CU_ASSERT_EQUAL_FATAL(array_add(values, &key), ERROR_SUCCESS);
+            }
+        }
+
+        Histogram *hist = array_histogram(values);
+
+        CU_ASSERT_PTR_NOT_NULL_FATAL(hist);
+        CU_ASSERT_FALSE(hist->b_dense);
+
+        for (int idx = 0; idx < HISTOGRAM_TEST_KEYS; idx++)
+        {
+            int key = (idx - HISTOGRAM_TEST_KEYS / 2) * strides[test];
+
+            CU_ASSERT_EQUAL_FATAL(histogram_count(hist, key), idx % 3 + 1);
+            CU_ASSERT_EQUAL_FATAL(histogram_count(hist, key + 1), 0);
+        }
+
+        histogram_destroy(hist);
+        array_destroy(values);
+    }
+}
+
+/**
+ * @brief Checks every bound search for one key against a linear scan.
+ *
+ * Both the branchless integer path (NULL comparator) and the comparator
+ * path are run.
+ */
+static void
+check_bounds (const Array *array, int key)
+{
+    int below = 0;
+    int upto  = 0;
+
+    for (int idx = 0; idx < array->idx; idx++)
+    {
+        below += (ARRAY_AT(array, int, idx) < key);
+        upto += (ARRAY_AT(array, int, idx) <= key);
+    }
+
+    for (int pass = 0; pass < 2; pass++)
+    {
+        ArrayCompare compare  = (0 == pass) ? NULL : compare_int;
+        int          range[2] = { -1, -1 };
+
+        CU_ASSERT_EQUAL_FATAL(array_lower_bound(array, &key, compare), below);
+        CU_ASSERT_EQUAL_FATAL(array_upper_bound(array, &key, compare), upto);
+        CU_ASSERT_EQUAL_FATAL(array_equal_range(array, &key, compare, range),
+                              ERROR_SUCCESS);
+        CU_ASSERT_EQUAL_FATAL(range[0], below);
+        CU_ASSERT_EQUAL_FATAL(range[1], upto);
+    }
+}
+
+/**
+ * @brief Test case for `array_lower_bound`, `array_upper_bound` and
+ * `array_equal_range`.
+ *
+ * Sorted arrays of every length up to `BOUND_TEST_LENGTH`, starting with
+ * the empty array, hold runs of duplicates and the `int` extremes. Each is
+ * searched for every stored value, its neighbours, and keys below and
+ * above every element.
+ */
+static void
+test_bounds (void)
+{
+    const int extremes[] = { INT_MIN, INT_MIN + 1, -1, 0, INT_MAX - 1,
+                             INT_MAX };
+    Array    *array      = array_initialization(TYPE_INT);
+
+    CU_ASSERT_PTR_NOT_NULL_FATAL(array);
+    srand(2024);
+
+    for (int len = 0; len <= BOUND_TEST_LENGTH; len++)
+    {
+        array_reset(array);
+
+        for (int idx = 0; idx < len; idx++)
+        {
+            // Few distinct values make long runs; the ends pin the extremes
+            int value = (rand() % 7 - 3) * 5;
+
+            if ((0 == idx % 9) && (0 < idx))
+            {
+                value = (0 == idx % 2) ? INT_MIN : INT_MAX;
+            }
+
+            CU_ASSERT_EQUAL_FATAL(array_add(array, &value), ERROR_SUCCESS);
+        }
+
+        CU_ASSERT_EQUAL_FATAL(array_sort(array, NULL), ERROR_SUCCESS);
+
+        for (size_t idx = 0; idx < sizeof(extremes) / sizeof(int); idx++)
+        {
+            check_bounds(array, extremes[idx]);
+        }
+
+        for (int idx = 0; idx < len; idx++)
+        {
+            int value = ARRAY_AT(array, int, idx);
+
+            check_bounds(array, value);
+
+            if (INT_MIN < value)
+            {
+                check_bounds(array, value - 1);
+            }
+
+            if (INT_MAX > value)
+            {
+                check_bounds(array, value + 1);
+            }
+        }
+    }
+
+    // Only integer arrays can be searched without a comparator
+    Array *pairs  = array_initialization_custom(2 * sizeof(int));
+    int    key[2] = { 0, 0 };
+
+    CU_ASSERT_PTR_NOT_NULL_FATAL(pairs);
+    CU_ASSERT_EQUAL(array_lower_bound(pairs, key, NULL), ERROR_INVALID_INPUT);
+    CU_ASSERT_EQUAL(array_lower_bound(array, NULL, NULL), ERROR_NULL_POINTER);
+
+    array_destroy(pairs);
+    array_destroy(array);
+}
+
+/**
+ * @brief Test case for the padded grid.
+ *
+ * A ragged buffer with CRLF and LF line endings is loaded with a two-cell
+ * border. Every cell of the border and every cell past the end of a short
+ * line must hold the sentinel, and neighbour steps taken with
+ * `grid_offset` from each corner must read the border rather than leave
+ * the buffer.
+ */
+static void
+test_grid (void)
+{
+    const char text[]     = "ab\r\ncde\nf\n";
+    const char rows[3][4] = { "ab#", "cde", "f##" };
+    Grid      *grid       = grid_from_buffer(text, sizeof(text) - 1, 2, '#');
+
+    CU_ASSERT_PTR_NOT_NULL_FATAL(grid);
+    CU_ASSERT_EQUAL_FATAL(grid->width, 3);
+    CU_ASSERT_EQUAL_FATAL(grid->height, 3);
+
+    for (int row = -grid->pad; row < grid->height + grid->pad; row++)
+    {
+        for (int col = -grid->pad; col < grid->width + grid->pad; col++)
+        {
+            bool b_inside = (0 <= row) && (grid->height > row) && (0 <= col)
+                            && (grid->width > col);
+            char expected = (true == b_inside) ? rows[row][col] : '#';
+
+            CU_ASSERT_EQUAL_FATAL(GRID_AT(grid, row, col), expected);
+        }
+    }
+
+    // Up to `pad` steps in any direction from a corner stay in the buffer
+    const int corners[4][2] = { { 0, 0 }, { 0, 2 }, { 2, 0 }, { 2, 2 } };
+
+    for (int corner = 0; corner < 4; corner++)
+    {
+        const char *origin
+            = &GRID_AT(grid, corners[corner][0], corners[corner][1]);
+
+        for (int drow = -1; drow <= 1; drow++)
+        {
+            for (int dcol = -1; dcol <= 1; dcol++)
+            {
+                for (int step = 1; step <= grid->pad; step++)
+                {
+                    int row = corners[corner][0] + step * drow;
+                    int col = corners[corner][1] + step * dcol;
+
+                    CU_ASSERT_EQUAL_FATAL(
+                        origin[step * grid_offset(grid, drow, dcol)],
+                        GRID_AT(grid, row, col));
+                }
+            }
+        }
+    }
+
+    grid_destroy(grid);
+
+    // An empty buffer gives an empty grid whose border is still readable
+    grid = grid_from_buffer("", 0, 1, '.');
+    CU_ASSERT_PTR_NOT_NULL_FATAL(grid);
+    CU_ASSERT_EQUAL(grid->width, 0);
+    CU_ASSERT_EQUAL(grid->height, 0);
+    CU_ASSERT_EQUAL(GRID_AT(grid, -1, -1), '.');
+    CU_ASSERT_EQUAL(GRID_AT(grid, 0, 0), '.');
+    grid_destroy(grid);
+
+    // A file without a final newline keeps its last row
+    grid = grid_load("data/example_4.txt", 1, '.');
+    CU_ASSERT_PTR_NOT_NULL_FATAL(grid);
+    CU_ASSERT_EQUAL(grid->width, 10);
+    CU_ASSERT_EQUAL(grid->height, 10);
+    CU_ASSERT_EQUAL(GRID_AT(grid, 0, 0), 'M');
+    CU_ASSERT_EQUAL(GRID_AT(grid, 9, 9), 'X');
+    CU_ASSERT_EQUAL(GRID_AT(grid, 10, 9), '.');
+    CU_ASSERT_EQUAL(GRID_AT(grid, 9, 10), '.');
+    grid_destroy(grid);
+}
+
+/**
+ * @brief Test case for `table_transpose` and `table_diagonals`.
+ *
+ * Ragged tables of bytes and of ints, rotated so the ring head is not at
+ * slot zero, are transformed into a destination that already holds rows.
+ * Every output cell is checked against the source cell it names, or the
+ * fill value past the end of a short row.
+ */
+static void
+test_table_transforms (void)
+{
+    const char *lines[] = { "abcd", "ef", "", "ghijk" };
+    const int   rows    = 4;
+    const int   width   = 5;
+
+    for (int pass = 0; pass < 2; pass++)
+    {
+        ElementType type   = (0 == pass) ? TYPE_CHAR : TYPE_INT;
+        Table      *src    = table_initialization(type, rows);
+        Table      *dst    = table_initialization(type, 2);
+        int         i_fill = -1;
+        char        c_fill = '.';
+        const void *fill   = (0 == pass) ? (const void *)&c_fill
+                                         : (const void *)&i_fill;
+
+        CU_ASSERT_PTR_NOT_NULL_FATAL(src);
+        CU_ASSERT_PTR_NOT_NULL_FATAL(dst);
+
+        // Logical row r ends up holding lines[r] after the rotation
+        for (int row = 0; row < rows; row++)
+        {
+            const char *line = lines[(row + rows - 1) % rows];
+
+            for (int col = 0; '\0' != line[col]; col++)
+            {
+                int value = line[col];
+
+                CU_ASSERT_EQUAL_FATAL(
+                    table_add_element(
+                        src, row, (0 == pass) ? (void *)&line[col] : &value),
+                    ERROR_SUCCESS);
+            }
+        }
+
+        CU_ASSERT_EQUAL_FATAL(table_rotate_rows(src), ERROR_SUCCESS);
+        fill_array(table_get_row(dst, 1), MOVE_TEST_HEAP, 0);
+
+        for (int shape = 0; shape < 3; shape++)
+        {
+            int status = (0 == shape)
+                             ? table_transpose(src, dst, fill)
+                             : table_diagonals(src, dst, 2 == shape, fill);
+            int count  = (0 == shape) ? width : rows + width - 1;
+
+            CU_ASSERT_EQUAL_FATAL(status, ERROR_SUCCESS);
+            CU_ASSERT_FATAL(dst->num_rows >= count);
+
+            for (int out = 0; out < dst->num_rows; out++)
+            {
+                const Array *array = table_get_row(dst, out);
+                int          row   = 0;
+                int          col   = out;
+                int          step  = (2 == shape) ? -1 : 1;
+
+                if (0 < shape)
+                {
+                    table_diagonal_start(
+                        rows, width, out, 2 == shape, &row, &col);
+                }
+
+                for (int idx = 0; idx < array->idx; idx++)
+                {
+                    const char *line     = lines[row + idx];
+                    int         cell     = col + ((0 < shape) ? step * idx : 0);
+                    int         expected = (0 == pass) ? '.' : -1;
+                    int         actual   = (0 == pass)
+                                               ? ARRAY_AT(array, char, idx)
+                                               : ARRAY_AT(array, int, idx);
+
+                    if ((int)strlen(line) > cell)
+                    {
+                        expected = line[cell];
+                    }
+
+                    CU_ASSERT_EQUAL_FATAL(actual, expected);
+                }
+
+                // Each output row runs until its walk leaves the table
+                int end_row = row + array->idx;
+                int end_col = (0 == shape) ? col : col + step * array->idx;
+
+                CU_ASSERT_FATAL((out >= count) || (rows == end_row)
+                                || (0 > end_col) || (width == end_col));
+                CU_ASSERT_FATAL((out < count) || (0 == array->idx));
+            }
+        }
+
+        table_destroy(src);
+        table_destroy(dst);
+    }
+}
+
+/**
+ * @brief Counts the set bits in every storage word of a bit matrix.
+ *
+ * Padding bits past the last column are counted too, so a write outside
+ * the matrix shows up even where `bitmatrix_test` cannot see it.
+ */
+static int
+bitmatrix_count (const BitMatrix *matrix)
+{
+    int    count     = 0;
+    size_t num_words = (size_t)matrix->num_rows * matrix->words_per_row;
+
+    for (size_t idx = 0; idx < num_words; idx++)
+    {
+        for (uint64_t word = matrix->words[idx]; 0 != word; word &= word - 1)
+        {
+            count++;
+        }
+    }
+
+    return count;
+}
+
+/**
+ * @brief Test case for setting, clearing and testing `BitMatrix` bits.
+ *
+ * Columns 63 and 64 sit on either side of a word boundary and the last
+ * column is alone in its row's final word. Positions outside the matrix
+ * must be refused without touching any bit, and a reset must clear them
+ * all. A resize must clear every bit and move the bounds with the size.
+ */
+static void
+test_bitmatrix (void)
+{
+    const int  cols[]   = { 0, 63, 64, BITMATRIX_TEST_COLS - 1 };
+    const int  bad[][2] = { { -1, 0 },
+                            { BITMATRIX_TEST_ROWS, 0 },
+                            { 0, -1 },
+                            { 0, BITMATRIX_TEST_COLS },
+                            { BITMATRIX_TEST_ROWS - 1, 192 } };
+    BitMatrix *matrix
+        = bitmatrix_initialization(BITMATRIX_TEST_ROWS, BITMATRIX_TEST_COLS);
+
+    CU_ASSERT_PTR_NOT_NULL_FATAL(matrix);
+    CU_ASSERT_EQUAL_FATAL(matrix->words_per_row, 3);
+
+    for (int row = 0; row < BITMATRIX_TEST_ROWS; row++)
+    {
+        for (int idx = 0; idx < 4; idx++)
+        {
+            int col = cols[idx];
+
+            CU_ASSERT_FALSE(bitmatrix_test(matrix, row, col));
+            CU_ASSERT_EQUAL(bitmatrix_set(matrix, row, col), ERROR_SUCCESS);
+            CU_ASSERT_TRUE(bitmatrix_test(matrix, row, col));
+            CU_ASSERT_EQUAL(bitmatrix_count(matrix), row * 4 + idx + 1);
+        }
+    }
+
+    // Clearing column 64 must leave column 63, in the word below, alone
+    CU_ASSERT_EQUAL(bitmatrix_clear(matrix, 1, 64), ERROR_SUCCESS);
+    CU_ASSERT_FALSE(bitmatrix_test(matrix, 1, 64));
+    CU_ASSERT_TRUE(bitmatrix_test(matrix, 1, 63));
+    CU_ASSERT_TRUE(bitmatrix_test(matrix, 0, 64));
+    CU_ASSERT_TRUE(bitmatrix_test(matrix, 2, 64));
+    CU_ASSERT_EQUAL(bitmatrix_count(matrix), 4 * BITMATRIX_TEST_ROWS - 1);
+
+    for (int idx = 0; idx < 5; idx++)
+    {
+        CU_ASSERT_EQUAL(bitmatrix_set(matrix, bad[idx][0], bad[idx][1]),
+                        ERROR_INDEX_OUT_OF_BOUNDS);
+        CU_ASSERT_EQUAL(bitmatrix_clear(matrix, bad[idx][0], bad[idx][1]),
+                        ERROR_INDEX_OUT_OF_BOUNDS);
+        CU_ASSERT_FALSE(bitmatrix_test(matrix, bad[idx][0], bad[idx][1]));
+    }
+
+    CU_ASSERT_EQUAL(bitmatrix_count(matrix), 4 * BITMATRIX_TEST_ROWS - 1);
+    CU_ASSERT_EQUAL(bitmatrix_set(NULL, 0, 0), ERROR_NULL_POINTER);
+    CU_ASSERT_FALSE(bitmatrix_test(NULL, 0, 0));
+
+    bitmatrix_reset(matrix);
+    CU_ASSERT_EQUAL(bitmatrix_count(matrix), 0);
+
+    for (int idx = 0; idx < 4; idx++)
+    {
+        CU_ASSERT_FALSE(bitmatrix_test(matrix, 1, cols[idx]));
+    }
+
+    // Shrinking keeps the storage, but the bounds follow the new size
+    uint64_t *words = matrix->words;
+
+    CU_ASSERT_EQUAL(bitmatrix_set(matrix, 0, 64), ERROR_SUCCESS);
+    CU_ASSERT_EQUAL_FATAL(bitmatrix_resize(matrix, 2, 64), ERROR_SUCCESS);
+    CU_ASSERT_PTR_EQUAL_FATAL(matrix->words, words);
+    CU_ASSERT_EQUAL(matrix->words_per_row, 1);
+    CU_ASSERT_EQUAL(bitmatrix_count(matrix), 0);
+    CU_ASSERT_EQUAL(bitmatrix_set(matrix, 1, 63), ERROR_SUCCESS);
+    CU_ASSERT_TRUE(bitmatrix_test(matrix, 1, 63));
+    CU_ASSERT_EQUAL(bitmatrix_set(matrix, 0, 64), ERROR_INDEX_OUT_OF_BOUNDS);
+    CU_ASSERT_EQUAL(bitmatrix_set(matrix, 2, 0), ERROR_INDEX_OUT_OF_BOUNDS);
+    CU_ASSERT_EQUAL(bitmatrix_count(matrix), 1);
+
+    // Growing past the storage reallocates it, still cleared
+    CU_ASSERT_EQUAL_FATAL(bitmatrix_resize(matrix, 4, 1000), ERROR_SUCCESS);
+    CU_ASSERT_EQUAL(bitmatrix_count(matrix), 0);
+    CU_ASSERT_EQUAL(bitmatrix_set(matrix, 3, 999), ERROR_SUCCESS);
+    CU_ASSERT_TRUE(bitmatrix_test(matrix, 3, 999));
+    CU_ASSERT_EQUAL(bitmatrix_resize(matrix, -1, 0), ERROR_INVALID_INPUT);
+    CU_ASSERT_TRUE(bitmatrix_test(matrix, 3, 999));
+
+    bitmatrix_destroy(matrix);
+}
+
+/**
+ * @brief Test case for freezing and topologically sorting a graph.
+ *
+ * A random acyclic graph is built over shuffled node ids, so the ids say
+ * nothing about the order. After freezing, the successor lists and edge
+ * queries must match the edges added, and the topological order must put
+ * the source of every edge before its destination. A graph with a cycle
+ * must be reported, with only the nodes ahead of the cycle ordered.
+ */
+static void
+test_graph_topology (void)
+{
+    int  rank[GRAPH_TEST_NODES];
+    int  position[GRAPH_TEST_NODES];
+    bool b_edge[GRAPH_TEST_NODES][GRAPH_TEST_NODES] = { { false } };
+
+    Graph *graph = graph_initialization();
+    Array *order = array_initialization(TYPE_INT);
+
+    CU_ASSERT_PTR_NOT_NULL_FATAL(graph);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(order);
+    srand(2024);
+
+    // rank[i] is the node placed i-th in a hidden valid order
+    for (int idx = 0; idx < GRAPH_TEST_NODES; idx++)
+    {
+        rank[idx] = idx;
+    }
+
+    for (int idx = GRAPH_TEST_NODES - 1; idx > 0; idx--)
+    {
+        int swap = rand() % (idx + 1);
+        int node = rank[idx];
+
+        rank[idx]  = rank[swap];
+        rank[swap] = node;
+    }
+
+    for (int lhs = 0; lhs < GRAPH_TEST_NODES; lhs++)
+    {
+        for (int rhs = lhs + 1; rhs < GRAPH_TEST_NODES; rhs++)
+        {
+            if (0 == rand() % 6)
+            {
+                b_edge[rank[lhs]][rank[rhs]] = true;
+                CU_ASSERT_EQUAL_FATAL(
+                    graph_add_edge(graph, rank[lhs], rank[rhs]),
+                    ERROR_SUCCESS);
+            }
+        }
+    }
+
+    CU_ASSERT_EQUAL_FATAL(graph_freeze(graph), ERROR_SUCCESS);
+    CU_ASSERT_EQUAL(graph_add_edge(graph, 0, 1), ERROR_INVALID_INPUT);
+
+    for (int from = 0; from < GRAPH_TEST_NODES; from++)
+    {
+        int        count      = 0;
+        int        expected   = 0;
+        const int *successors = graph_neighbours(graph, from, &count);
+
+        CU_ASSERT_PTR_NOT_NULL_FATAL(successors);
+
+        for (int to = 0; to < GRAPH_TEST_NODES; to++)
+        {
+            expected += (true == b_edge[from][to]);
+            CU_ASSERT_EQUAL_FATAL(graph_has_edge(graph, from, to),
+                                  b_edge[from][to]);
+        }
+
+        CU_ASSERT_EQUAL_FATAL(count, expected);
+
+        for (int idx = 0; idx < count; idx++)
+        {
+            CU_ASSERT_FATAL(b_edge[from][successors[idx]]);
+        }
+    }
+
+    CU_ASSERT_EQUAL_FATAL(graph_topological_sort(graph, order), ERROR_SUCCESS);
+    CU_ASSERT_EQUAL_FATAL(order->idx, GRAPH_TEST_NODES);
+    memset(position, -1, sizeof(position));
+
+    for (int idx = 0; idx < order->idx; idx++)
+    {
+        int node = ARRAY_AT(order, int, idx);
+
+        CU_ASSERT_EQUAL_FATAL(position[node], -1);
+        position[node] = idx;
+    }
+
+    for (int from = 0; from < GRAPH_TEST_NODES; from++)
+    {
+        for (int to = 0; to < GRAPH_TEST_NODES; to++)
+        {
+            CU_ASSERT_FATAL((false == b_edge[from][to])
+                            || (position[from] < position[to]));
+        }
+    }
+
+    graph_destroy(graph);
+
+    // 3 -> 0 -> 1 -> 2 -> 0 and 2 -> 4: only node 3 precedes the cycle
+    const int cycle[][2] = { { 3, 0 }, { 0, 1 }, { 1, 2 }, { 2, 0 }, { 2, 4 } };
+
+    graph = graph_initialization();
+    CU_ASSERT_PTR_NOT_NULL_FATAL(graph);
+
+    for (size_t idx = 0; idx < sizeof(cycle) / sizeof(cycle[0]); idx++)
+    {
+        CU_ASSERT_EQUAL_FATAL(
+            graph_add_edge(graph, cycle[idx][0], cycle[idx][1]),
+            ERROR_SUCCESS);
+    }
+
+    CU_ASSERT_EQUAL_FATAL(graph_freeze(graph), ERROR_SUCCESS);
+    CU_ASSERT_EQUAL(graph_topological_sort(graph, order), ERROR_CYCLE_DETECTED);
+    CU_ASSERT_EQUAL(order->idx, 1);
+    CU_ASSERT_EQUAL(ARRAY_AT(order, int, 0), 3);
+    CU_ASSERT_TRUE(graph_has_edge(graph, 2, 0));
+    CU_ASSERT_FALSE(graph_has_edge(graph, 0, 2));
+
+    graph_destroy(graph);
+    array_destroy(order);
+}
+
+/**
+ * @brief Walled grid searched by `test_graph_search`; `#` is a wall.
+ *
+ * Cell (5, 4) is closed in on every side.
+ */
+static const char *g_maze[SEARCH_TEST_ROWS] = {
+    "........", ".######.", ".#....#.", ".#.##.#.", ".#..#...", "...#.#.#",
+};
+
+/**
+ * @brief Lists the open cells next to a cell of `g_maze`, at weight 1.
+ */
+static int
+maze_neighbours (int node, int *neighbours, int *weights, void *ctx)
+{
+    const int steps[4][2] = { { -1, 0 }, { 1, 0 }, { 0, -1 }, { 0, 1 } };
+    int       row         = node / SEARCH_TEST_COLS;
+    int       col         = node % SEARCH_TEST_COLS;
+    int       count       = 0;
+
+    (void)ctx;
+
+    for (int idx = 0; idx < 4; idx++)
+    {
+        int next_row = row + steps[idx][0];
+        int next_col = col + steps[idx][1];
+
+        if ((0 <= next_row) && (SEARCH_TEST_ROWS > next_row) && (0 <= next_col)
+            && (SEARCH_TEST_COLS > next_col)
+            && ('#' != g_maze[next_row][next_col]))
+        {
+            neighbours[count] = GRAPH_GRID_NODE(SEARCH_TEST_COLS,
+                                                next_row,
+                                                next_col);
+            weights[count++]  = 1;
+        }
+    }
+
+    return count;
+}
+
+/**
+ * @brief Manhattan distance between two cells of `g_maze`.
+ */
+static long long
+maze_distance (int node, int goal, void *ctx)
+{
+    (void)ctx;
+
+    return abs(node / SEARCH_TEST_COLS - goal / SEARCH_TEST_COLS)
+           + abs(node % SEARCH_TEST_COLS - goal % SEARCH_TEST_COLS);
+}
+
+/**
+ * @brief Test case for BFS, Dijkstra and A* over both kinds of source.
+ *
+ * A small CSR graph checks hop counts and a weighted shortest path that
+ * avoids the direct edge. A* over the walled grid must match the BFS
+ * distance to every open cell and follow a wall-free path, and report the
+ * enclosed cell as unreachable. One search state is reused throughout,
+ * moving from the larger grid to the smaller graph and back, so stale
+ * state from a bigger search must not leak into a smaller one.
+ */
+static void
+test_graph_search (void)
+{
+    // 0 -> 2 directly costs 10, but 0 -> 1 -> 2 costs 7; 6 -> 5 is cut off
+    const int edges[][3] = { { 0, 2, 10 }, { 0, 1, 3 }, { 1, 2, 4 },
+                             { 0, 3, 1 },  { 3, 2, 8 }, { 2, 4, 1 },
+                             { 6, 5, 1 } };
+
+    const long long hops[]  = { 0, 1, 1, 1, 2, GRAPH_UNREACHABLE,
+                                GRAPH_UNREACHABLE };
+    const long long costs[] = { 0, 3, 7, 1, 8, GRAPH_UNREACHABLE,
+                                GRAPH_UNREACHABLE };
+
+    Graph       *graph  = graph_initialization();
+    GraphSearch *search = graph_search_initialization();
+    long long    maze_hops[SEARCH_TEST_ROWS * SEARCH_TEST_COLS];
+
+    CU_ASSERT_PTR_NOT_NULL_FATAL(graph);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(search);
+
+    for (size_t idx = 0; idx < sizeof(edges) / sizeof(edges[0]); idx++)
+    {
+        CU_ASSERT_EQUAL_FATAL(
+            graph_add_weighted_edge(
+                graph, edges[idx][0], edges[idx][1], edges[idx][2]),
+            ERROR_SUCCESS);
+    }
+
+    CU_ASSERT_EQUAL_FATAL(graph_freeze(graph), ERROR_SUCCESS);
+
+    GraphSource csr   = graph_source_csr(graph);
+    GraphSource maze  = graph_source_grid(
+        SEARCH_TEST_COLS, SEARCH_TEST_ROWS, maze_neighbours, NULL);
+    int         start = GRAPH_GRID_NODE(SEARCH_TEST_COLS, 0, 0);
+    int         shut  = GRAPH_GRID_NODE(SEARCH_TEST_COLS, 5, 4);
+
+    // Mark every node of the larger grid before searching the smaller graph
+    CU_ASSERT_EQUAL_FATAL(graph_bfs(search, &maze, start), ERROR_SUCCESS);
+    memcpy(maze_hops, search->dist, sizeof(maze_hops));
+    CU_ASSERT_EQUAL(maze_hops[shut], GRAPH_UNREACHABLE);
+
+    for (int pass = 0; pass < 2; pass++)
+    {
+        const long long *expected = (0 == pass) ? hops : costs;
+        int              status   = (0 == pass)
+                                        ? graph_bfs(search, &csr, 0)
+                                        : graph_dijkstra(search, &csr, 0, -1);
+
+        CU_ASSERT_EQUAL_FATAL(status, ERROR_SUCCESS);
+        CU_ASSERT_EQUAL_FATAL(search->num_nodes, csr.num_nodes);
+        CU_ASSERT_EQUAL_FATAL(search->visited->num_cols, csr.num_nodes);
+        CU_ASSERT_EQUAL_FATAL(search->visited->words_per_row,
+                              (csr.num_nodes + 63) / BITMATRIX_WORD_BITS);
+        CU_ASSERT_FATAL(search->capacity >= maze.num_nodes);
+
+        for (int node = 0; node < csr.num_nodes; node++)
+        {
+            CU_ASSERT_EQUAL_FATAL(search->dist[node], expected[node]);
+        }
+
+        // Stopping at a goal still settles it at its shortest distance
+        if (1 == pass)
+        {
+            CU_ASSERT_EQUAL_FATAL(graph_dijkstra(search, &csr, 0, 2),
+                                  ERROR_SUCCESS);
+            CU_ASSERT_EQUAL_FATAL(search->dist[2], 7);
+            CU_ASSERT_EQUAL_FATAL(search->parent[2], 1);
+        }
+    }
+
+    for (int goal = 0; goal < maze.num_nodes; goal++)
+    {
+        int status
+            = graph_astar(search, &maze, start, goal, maze_distance, NULL);
+
+        if (GRAPH_UNREACHABLE == maze_hops[goal])
+        {
+            CU_ASSERT_EQUAL_FATAL(status, ERROR_ELEMENT_NOT_FOUND);
+            continue;
+        }
+
+        CU_ASSERT_EQUAL_FATAL(status, ERROR_SUCCESS);
+        CU_ASSERT_EQUAL_FATAL(search->dist[goal], maze_hops[goal]);
+
+        // Walk the path back; every step is to an open, adjacent cell
+        int steps = 0;
+
+        for (int node = goal; start != node; node = search->parent[node])
+        {
+            int prev = search->parent[node];
+
+            CU_ASSERT_FATAL(0 <= prev);
+            CU_ASSERT_EQUAL_FATAL(maze_distance(node, prev, NULL), 1);
+            CU_ASSERT_NOT_EQUAL_FATAL(g_maze[node / SEARCH_TEST_COLS]
+                                            [node % SEARCH_TEST_COLS],
+                                      '#');
+            steps++;
+        }
+
+        CU_ASSERT_EQUAL_FATAL(steps, maze_hops[goal]);
+    }
+
+    CU_ASSERT_EQUAL(
+        graph_astar(search, &maze, start, shut, maze_distance, NULL),
+        ERROR_ELEMENT_NOT_FOUND);
+
+    graph_search_destroy(search);
+    graph_destroy(graph);
 }
 
 /*** end of file ***/